@@ -0,0 +1,47 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <cstdlib>
+#include <iostream>
+
+#include <rapidcheck.h>
+
+#include "rapidcheck/detail/Fuzzing.h"
+
+namespace rc {
+namespace detail {
+
+inline int checkFuzzInput(const Property &property,
+                          const std::uint8_t *data,
+                          std::size_t size) {
+  const auto result = fuzzProperty(property, data, size);
+  if (result.is<FailureResult>()) {
+    printResultMessage(result, std::cerr);
+    std::cerr << std::endl;
+    std::abort();
+  }
+
+  // Inputs that are discarded are rejected so that they are not added to the
+  // corpus
+  return result.is<GaveUpResult>() ? -1 : 0;
+}
+
+} // namespace detail
+} // namespace rc
+
+/// Defines a RapidCheck property as the libFuzzer entry point
+/// `LLVMFuzzerTestOneInput`. Every input runs a single test case of the
+/// property with the values that would be drawn from `Random` taken from the
+/// input. A failing test case aborts so that the fuzzer reports it as a crash.
+#define RC_FUZZ_TARGET(ArgList)                                                \
+  static void rapidCheck_fuzzTargetImpl ArgList;                               \
+                                                                               \
+  extern "C" int LLVMFuzzerTestOneInput(const std::uint8_t *data,              \
+                                        std::size_t size) {                    \
+    static const auto property =                                               \
+        ::rc::detail::toProperty(&rapidCheck_fuzzTargetImpl);                  \
+    return ::rc::detail::checkFuzzInput(property, data, size);                 \
+  }                                                                            \
+                                                                               \
+  static void rapidCheck_fuzzTargetImpl ArgList
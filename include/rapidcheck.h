@@ -16,6 +16,7 @@
 #include "rapidcheck/shrinkable/Transform.h"
 
 #include "rapidcheck/Gen.h"
+#include "rapidcheck/gen/Aggregate.h"
 #include "rapidcheck/gen/Arbitrary.h"
 #include "rapidcheck/gen/Build.h"
 #include "rapidcheck/gen/Chrono.h"
@@ -25,6 +26,7 @@
 #include "rapidcheck/gen/Maybe.h"
 #include "rapidcheck/gen/Numeric.h"
 #include "rapidcheck/gen/Predicate.h"
+#include "rapidcheck/gen/Recursive.h"
 #include "rapidcheck/gen/Select.h"
 #include "rapidcheck/gen/Text.h"
 #include "rapidcheck/gen/Transform.h"
@@ -33,5 +35,7 @@
 #include "rapidcheck/Assertions.h"
 #include "rapidcheck/Check.h"
 #include "rapidcheck/Classify.h"
+#include "rapidcheck/Complexity.h"
 #include "rapidcheck/Log.h"
+#include "rapidcheck/Target.h"
 #include "rapidcheck/Show.h"
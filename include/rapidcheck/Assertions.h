@@ -1,5 +1,8 @@
 #pragma once
 
+#include <chrono>
+#include <functional>
+
 #include "rapidcheck/detail/Results.h"
 #include "rapidcheck/detail/Capture.h"
 
@@ -74,6 +77,35 @@
                                        ", " #ExceptionType ")"));              \
   } while (false)
 
+/// Fails the current test case if evaluating the given expression takes longer
+/// than `budget`, a `std::chrono::duration`. Since timings are noisy, an
+/// expression that takes too long is evaluated again, up to five times in
+/// total, and the test case only fails if none of the evaluations is within the
+/// budget. The expression must therefore leave everything it uses in the same
+/// state so that every evaluation does the same work, use
+/// `RC_ASSERT_WITHIN_ATTEMPTS` with a single attempt otherwise. The fraction of
+/// the budget that was used is reported using `RC_TARGET` so that RapidCheck
+/// searches for the slowest inputs.
+#define RC_ASSERT_WITHIN(budget, expression)                                   \
+  ::rc::detail::assertWithin(                                                  \
+      std::chrono::duration_cast<std::chrono::nanoseconds>(budget),            \
+      ::rc::detail::kBudgetAttempts,                                           \
+      [&] { expression; },                                                     \
+      __FILE__,                                                                \
+      __LINE__,                                                                \
+      "RC_ASSERT_WITHIN(" #budget ", " #expression ")")
+
+/// Like `RC_ASSERT_WITHIN` but evaluates the expression at most `attempts`
+/// times.
+#define RC_ASSERT_WITHIN_ATTEMPTS(budget, attempts, expression)                \
+  ::rc::detail::assertWithin(                                                  \
+      std::chrono::duration_cast<std::chrono::nanoseconds>(budget),            \
+      attempts,                                                                \
+      [&] { expression; },                                                     \
+      __FILE__,                                                                \
+      __LINE__,                                                                \
+      "RC_ASSERT_WITHIN_ATTEMPTS(" #budget ", " #attempts ", " #expression ")")
+
 /// Unconditionally fails the current test case with the given message.
 #define RC_FAIL(...)                                                           \
   RC_INTERNAL_UNCONDITIONAL_RESULT(Failure, "RC_FAIL", __VA_ARGS__)
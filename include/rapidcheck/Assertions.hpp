@@ -22,6 +22,29 @@ std::string makeWrongExceptionMessage(const std::string &file,
                                       const std::string &assertion,
                                       const std::string &expected);
 
+/// Returns the message for an expression that took `elapsed` in the fastest of
+/// `attempts` evaluations although the budget was `budget`.
+std::string makeBudgetMessage(const std::string &file,
+                              int line,
+                              const std::string &assertion,
+                              int attempts,
+                              std::chrono::nanoseconds elapsed,
+                              std::chrono::nanoseconds budget);
+
+/// The number of times an expression is evaluated by `RC_ASSERT_WITHIN` before
+/// deciding that it takes longer than the budget.
+constexpr int kBudgetAttempts = 5;
+
+/// Implementation of `RC_ASSERT_WITHIN`. Evaluates `expression` up to
+/// `attempts` times until one evaluation is within `budget` and throws a
+/// failure if none of them are.
+void assertWithin(std::chrono::nanoseconds budget,
+                  int attempts,
+                  const std::function<void()> &expression,
+                  const std::string &file,
+                  int line,
+                  const std::string &assertion);
+
 template <typename Expression>
 void doAssert(const Expression &expression,
               bool expectedResult,
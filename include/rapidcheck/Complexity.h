@@ -0,0 +1,40 @@
+#pragma once
+
+#include <chrono>
+#include <functional>
+#include <iosfwd>
+
+#include "rapidcheck/Maybe.h"
+
+namespace rc {
+
+/// The complexity classes that the runtime of a property can be fitted to.
+enum class Complexity {
+  /// O(1)
+  Constant,
+  /// O(n)
+  Linear,
+  /// O(n log n)
+  Linearithmic,
+  /// O(n^2)
+  Quadratic
+};
+
+std::ostream &operator<<(std::ostream &os, Complexity complexity);
+
+} // namespace rc
+
+/// Measures how long evaluating `expression` takes for an input of size `n`,
+/// for example the length of a container. When all test cases have been run,
+/// the complexity class that best fits the measurements is reported. Only the
+/// last measurement of each test case is used.
+#define RC_COMPLEXITY(n, expression)                                           \
+  ::rc::detail::measureComplexity(                                             \
+      (n), [&] { expression; }, ::rc::Nothing)
+
+/// Like `RC_COMPLEXITY` but the property fails if the complexity class that
+/// best fits the measurements is worse than `bound`, an `rc::Complexity`.
+#define RC_ASSERT_COMPLEXITY(bound, n, expression)                             \
+  ::rc::detail::measureComplexity((n), [&] { expression; }, (bound))
+
+#include "Complexity.hpp"
@@ -0,0 +1,30 @@
+#pragma once
+
+namespace rc {
+namespace detail {
+
+/// A measurement made by `RC_COMPLEXITY` or `RC_ASSERT_COMPLEXITY`.
+struct ComplexitySample {
+  /// The size of the input.
+  double n;
+  /// The time it took in seconds.
+  double seconds;
+  /// The worst complexity class that is allowed, if any.
+  Maybe<Complexity> bound;
+};
+
+std::ostream &operator<<(std::ostream &os, const ComplexitySample &sample);
+bool operator==(const ComplexitySample &lhs, const ComplexitySample &rhs);
+bool operator!=(const ComplexitySample &lhs, const ComplexitySample &rhs);
+
+/// The number of times an expression is evaluated by `RC_COMPLEXITY`. The
+/// shortest time is used since that is the least affected by noise.
+constexpr int kComplexityAttempts = 3;
+
+/// Implementation of `RC_COMPLEXITY` and `RC_ASSERT_COMPLEXITY`.
+void measureComplexity(double n,
+                       const std::function<void()> &expression,
+                       Maybe<Complexity> bound);
+
+} // namespace detail
+} // namespace rc
@@ -1,5 +1,8 @@
 #pragma once
 
+#include <memory>
+#include <string>
+
 #include "rapidcheck/Traits.h"
 #include "rapidcheck/Shrinkable.h"
 
@@ -7,6 +10,30 @@ namespace rc {
 
 class Random;
 
+template <typename T>
+class Gen;
+
+namespace detail {
+
+/// Returns the name of the given generator or `nullptr` if it has no name.
+template <typename T>
+const std::shared_ptr<const std::string> &nameOf(const Gen<T> &gen);
+
+class Any;
+
+} // namespace detail
+
+namespace gen {
+namespace detail {
+
+template <typename T>
+Gen<rc::detail::Any>
+eraseRequested(const void *gen,
+               const std::shared_ptr<const std::string> &name);
+
+} // namespace detail
+} // namespace gen
+
 /// The reference size. This is not a max limit on the generator size parameter
 /// but serves as a guideline. In general, genenerators for which there is a
 /// natural limit which is not too expensive to generate should max out at this.
@@ -60,13 +87,23 @@ public:
   ~Gen() noexcept;
 
 private:
+  template <typename U>
+  friend const std::shared_ptr<const std::string> &
+  detail::nameOf(const Gen<U> &gen);
+
+  template <typename U>
+  friend Gen<rc::detail::Any>
+  gen::detail::eraseRequested(const void *gen,
+                              const std::shared_ptr<const std::string> &name);
+
   class IGenImpl;
 
   template <typename Impl>
   class GenImpl;
 
   IGenImpl *m_impl;
-  std::string m_name;
+  // Shared so that copying generators does not copy the name
+  std::shared_ptr<const std::string> m_name;
 };
 
 } // namespace rc
@@ -6,6 +6,8 @@
 #include "rapidcheck/detail/ImplicitParam.h"
 #include "rapidcheck/gen/detail/GenerationHandler.h"
 #include "rapidcheck/shrinkable/Create.h"
+#include "rapidcheck/shrinkable/Transform.h"
+#include "rapidcheck/Maybe.h"
 #include  "rapidcheck/Compat.h"
 
 namespace rc {
@@ -16,6 +18,56 @@ template <typename T, typename Mapper>
 Gen<Decay<typename rc::compat::return_type<Mapper,T>::type>> map(Gen<T> gen,
                                                          Mapper &&mapper);
 
+namespace detail {
+
+template <typename T>
+Shrinkable<rc::detail::Any> generateRequested(const void *gen,
+                                              void *result,
+                                              const Random &random,
+                                              int size) {
+  auto shrinkable = (*static_cast<const Gen<T> *>(gen))(random, size);
+  *static_cast<Maybe<T> *>(result) = shrinkable.value();
+  return shrinkable::map(std::move(shrinkable), &rc::detail::Any::of<T>);
+}
+
+template <typename T>
+void setRequestedValue(void *result, rc::detail::Any &&value) {
+  *static_cast<Maybe<T> *>(result) = std::move(value.get<T>());
+}
+
+template <typename T>
+Gen<rc::detail::Any>
+eraseRequested(const void *gen,
+               const std::shared_ptr<const std::string> &name) {
+  auto anyGen =
+      gen::map(*static_cast<const Gen<T> *>(gen), &rc::detail::Any::of<T>);
+  anyGen.m_name = name;
+  return anyGen;
+}
+
+template <typename T>
+GenerationRequest::GenerationRequest(const Gen<T> &gen, Maybe<T> &result)
+    : m_gen(&gen)
+    , m_result(&result)
+    , m_name(&rc::detail::nameOf(gen))
+    , m_generate(&generateRequested<T>)
+    , m_setValue(&setRequestedValue<T>)
+    , m_erased(&eraseRequested<T>) {}
+
+inline Shrinkable<rc::detail::Any>
+GenerationRequest::generate(const Random &random, int size) {
+  return m_generate(m_gen, m_result, random, size);
+}
+
+inline void GenerationRequest::setValue(rc::detail::Any &&value) {
+  m_setValue(m_result, std::move(value));
+}
+
+inline Gen<rc::detail::Any> GenerationRequest::erased() const {
+  return m_erased(m_gen, *m_name);
+}
+
+} // namespace detail
 } // namespace gen
 
 template <typename T>
@@ -60,7 +112,7 @@ Gen<T>::Gen(Impl &&impl)
 
 template <typename T>
 std::string Gen<T>::name() const {
-  return m_name;
+  return m_name ? *m_name : std::string();
 }
 
 template <typename T>
@@ -81,14 +133,17 @@ T Gen<T>::operator*() const {
   using namespace detail;
   using rc::gen::detail::param::CurrentHandler;
   const auto handler = ImplicitParam<CurrentHandler>::value();
-  return std::move(handler->onGenerate(gen::map(*this, &Any::of<T>).as(m_name))
-                       .template get<T>());
+  Maybe<T> result;
+  gen::detail::GenerationRequest request(*this, result);
+  handler->onGenerateValue(request);
+  assert(result);
+  return std::move(*result);
 }
 
 template <typename T>
 Gen<T> Gen<T>::as(const std::string &name) const {
   auto gen = *this;
-  gen.m_name = name;
+  gen.m_name = std::make_shared<const std::string>(name);
   return gen;
 }
 
@@ -133,4 +188,12 @@ Gen<T>::~Gen() noexcept {
   }
 }
 
+namespace detail {
+
+template <typename T>
+const std::shared_ptr<const std::string> &nameOf(const Gen<T> &gen) {
+  return gen.m_name;
+}
+
+} // namespace detail
 } // namespace rc
@@ -0,0 +1,13 @@
+#pragma once
+
+/// Reports a value that RapidCheck should try to make as large as possible,
+/// for example the latency or the queue depth reached by the test case. Once
+/// half of the test cases have been run, the remaining ones are mostly spent
+/// exploring test cases that are close to the one with the highest value so
+/// far. If a threshold is given as a second argument, the test case fails if
+/// the value is greater than the threshold.
+#define RC_TARGET(...)                                                         \
+  ::rc::detail::target(                                                        \
+      __FILE__, __LINE__, "RC_TARGET(" #__VA_ARGS__ ")", __VA_ARGS__)
+
+#include "Target.hpp"
@@ -0,0 +1,23 @@
+#pragma once
+
+#include <string>
+
+namespace rc {
+namespace detail {
+
+/// Reports the given target value.
+void target(const std::string &file,
+            int line,
+            const std::string &assertion,
+            double value);
+
+/// Reports the given target value and fails the current test case if it is
+/// greater than `threshold`.
+void target(const std::string &file,
+            int line,
+            const std::string &assertion,
+            double value,
+            double threshold);
+
+} // namespace detail
+} // namespace rc
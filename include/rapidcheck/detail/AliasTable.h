@@ -0,0 +1,40 @@
+#pragma once
+
+#include <cstdint>
+#include <vector>
+
+namespace rc {
+namespace detail {
+
+/// Alternative to `FrequencyMap` which uses Vose's alias method to map a random
+/// number to an index into a table of weights in constant time, regardless of
+/// the size of the table. Building the table is more expensive than building a
+/// `FrequencyMap` so it pays off mostly for large tables.
+class AliasTable {
+public:
+  explicit AliasTable(const std::vector<std::size_t> &frequencies);
+
+  /// Maps a uniformly distributed random number to an index into the weights
+  /// table. The upper 32 bits select a column and the lower 32 bits decide
+  /// between the column and its alias.
+  ///
+  /// Must not be called if `sum()` is zero.
+  std::size_t lookup(std::uint64_t x) const;
+
+  /// Returns the sum of all the weights.
+  std::size_t sum() const;
+
+private:
+  struct Column {
+    /// The probability of picking this column rather than its alias, as a
+    /// fraction of 2^32.
+    std::uint64_t threshold;
+    std::size_t alias;
+  };
+
+  std::size_t m_sum;
+  std::vector<Column> m_columns;
+};
+
+} // namespace detail
+} // namespace rc
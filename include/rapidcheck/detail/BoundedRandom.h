@@ -0,0 +1,81 @@
+#pragma once
+
+#include <cstdint>
+
+#include "rapidcheck/Random.h"
+
+#if defined(_MSC_VER) && defined(_M_X64) && !defined(__SIZEOF_INT128__)
+#include <intrin.h>
+#endif
+
+namespace rc {
+namespace detail {
+
+/// Returns the full 128-bit product of `a` and `b` as a pair of high and low
+/// 64-bit halves.
+inline void multiply128(std::uint64_t a,
+                        std::uint64_t b,
+                        std::uint64_t &high,
+                        std::uint64_t &low) {
+#if defined(__SIZEOF_INT128__)
+  const auto product = static_cast<unsigned __int128>(a) * b;
+  high = static_cast<std::uint64_t>(product >> 64);
+  low = static_cast<std::uint64_t>(product);
+#elif defined(_MSC_VER) && defined(_M_X64)
+  low = _umul128(a, b, &high);
+#else
+  const auto aLow = a & 0xFFFFFFFFULL;
+  const auto aHigh = a >> 32;
+  const auto bLow = b & 0xFFFFFFFFULL;
+  const auto bHigh = b >> 32;
+
+  const auto ll = aLow * bLow;
+  const auto lh = aLow * bHigh;
+  const auto hl = aHigh * bLow;
+  const auto hh = aHigh * bHigh;
+
+  const auto mid = (ll >> 32) + (lh & 0xFFFFFFFFULL) + (hl & 0xFFFFFFFFULL);
+  high = hh + (lh >> 32) + (hl >> 32) + (mid >> 32);
+  low = (mid << 32) | (ll & 0xFFFFFFFFULL);
+#endif
+}
+
+/// Returns a uniformly distributed random number in the range `[0, n)`. If `n`
+/// is zero, the full range of `Random::Number` is used.
+///
+/// This uses Lemire's multiply-shift method which, unlike `next() % n`, is free
+/// from modulo bias and only needs a division in the rare case that the first
+/// draw has to be rejected.
+///
+/// A draw of zero is never rejected so that zeroed choices, as produced when
+/// shrinking with `shrink_engine=choices`, map to zero instead of drawing
+/// forever. This biases the result by at most 2^-64.
+inline Random::Number nextBounded(Random &random, Random::Number n) {
+  if (n == 0) {
+    return random.next();
+  }
+
+  std::uint64_t high;
+  std::uint64_t low;
+  auto draw = random.next();
+  multiply128(draw, n, high, low);
+  if (low < n) {
+    // (2^64 - n) % n, the number of values that would introduce bias
+    const auto threshold = (0 - n) % n;
+    while ((low < threshold) && (draw != 0)) {
+      draw = random.next();
+      multiply128(draw, n, high, low);
+    }
+  }
+
+  return high;
+}
+
+/// Overload of `nextBounded` for temporary `Random` instances such as those
+/// returned by `Random::split`.
+inline Random::Number nextBounded(Random &&random, Random::Number n) {
+  return nextBounded(random, n);
+}
+
+} // namespace detail
+} // namespace rc
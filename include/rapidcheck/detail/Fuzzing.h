@@ -0,0 +1,29 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+
+#include "rapidcheck/detail/Property.h"
+#include "rapidcheck/detail/Results.h"
+
+namespace rc {
+namespace detail {
+
+/// Runs a single test case of the given property where the values that would
+/// normally be drawn from `Random` are instead taken from the given bytes.
+/// This makes the generated test case a deterministic function of the bytes
+/// which lets coverage-guided fuzzers such as libFuzzer explore the property.
+/// Once the bytes are exhausted, the values from a fixed `Random` are used.
+///
+/// @param property  The property to run.
+/// @param data      The bytes to take the values from.
+/// @param size      The number of bytes.
+///
+/// @return `SuccessResult` if the case succeeded, `FailureResult` if it failed
+///         and `GaveUpResult` if it was discarded.
+TestResult fuzzProperty(const Property &property,
+                        const std::uint8_t *data,
+                        std::size_t size);
+
+} // namespace detail
+} // namespace rc
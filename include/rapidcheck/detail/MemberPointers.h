@@ -0,0 +1,158 @@
+#pragma once
+
+#include "rapidcheck/detail/Utility.h"
+
+// Helper macros for `RC_DERIVE_ARBITRARY`. `RC_INTERNAL_MEMBER_POINTERS(T, a,
+// b)` expands to `&T::a, &T::b` and supports up to 64 members.
+
+#define RC_INTERNAL_EXPAND(x) x
+
+#define RC_INTERNAL_NARGS_IMPL(_1, _2, _3, _4, _5, _6, _7, _8, _9, _10, _11,   \
+                               _12, _13, _14, _15, _16, _17, _18, _19, _20,    \
+                               _21, _22, _23, _24, _25, _26, _27, _28, _29,    \
+                               _30, _31, _32, _33, _34, _35, _36, _37, _38,    \
+                               _39, _40, _41, _42, _43, _44, _45, _46, _47,    \
+                               _48, _49, _50, _51, _52, _53, _54, _55, _56,    \
+                               _57, _58, _59, _60, _61, _62, _63, _64, N,      \
+                               ...) N
+#define RC_INTERNAL_NARGS(...)                                                 \
+  RC_INTERNAL_EXPAND(RC_INTERNAL_NARGS_IMPL(__VA_ARGS__, 64, 63, 62, 61, 60,   \
+                                         59, 58, 57, 56, 55, 54, 53, 52, 51,   \
+                                         50, 49, 48, 47, 46, 45, 44, 43, 42,   \
+                                         41, 40, 39, 38, 37, 36, 35, 34, 33,   \
+                                         32, 31, 30, 29, 28, 27, 26, 25, 24,   \
+                                         23, 22, 21, 20, 19, 18, 17, 16, 15,   \
+                                         14, 13, 12, 11, 10, 9, 8, 7, 6, 5,    \
+                                         4, 3, 2, 1))
+
+#define RC_INTERNAL_MEMBER_POINTERS(T, ...)                                    \
+  RC_INTERNAL_EXPAND(RC_GLUE(RC_INTERNAL_MEMBER_POINTERS_,                     \
+                             RC_INTERNAL_NARGS(__VA_ARGS__))(T, __VA_ARGS__))
+
+#define RC_INTERNAL_MEMBER_POINTERS_1(T, m) &T::m
+#define RC_INTERNAL_MEMBER_POINTERS_2(T, m, ...)                               \
+  &T::m, RC_INTERNAL_EXPAND(RC_INTERNAL_MEMBER_POINTERS_1(T, __VA_ARGS__))
+#define RC_INTERNAL_MEMBER_POINTERS_3(T, m, ...)                               \
+  &T::m, RC_INTERNAL_EXPAND(RC_INTERNAL_MEMBER_POINTERS_2(T, __VA_ARGS__))
+#define RC_INTERNAL_MEMBER_POINTERS_4(T, m, ...)                               \
+  &T::m, RC_INTERNAL_EXPAND(RC_INTERNAL_MEMBER_POINTERS_3(T, __VA_ARGS__))
+#define RC_INTERNAL_MEMBER_POINTERS_5(T, m, ...)                               \
+  &T::m, RC_INTERNAL_EXPAND(RC_INTERNAL_MEMBER_POINTERS_4(T, __VA_ARGS__))
+#define RC_INTERNAL_MEMBER_POINTERS_6(T, m, ...)                               \
+  &T::m, RC_INTERNAL_EXPAND(RC_INTERNAL_MEMBER_POINTERS_5(T, __VA_ARGS__))
+#define RC_INTERNAL_MEMBER_POINTERS_7(T, m, ...)                               \
+  &T::m, RC_INTERNAL_EXPAND(RC_INTERNAL_MEMBER_POINTERS_6(T, __VA_ARGS__))
+#define RC_INTERNAL_MEMBER_POINTERS_8(T, m, ...)                               \
+  &T::m, RC_INTERNAL_EXPAND(RC_INTERNAL_MEMBER_POINTERS_7(T, __VA_ARGS__))
+#define RC_INTERNAL_MEMBER_POINTERS_9(T, m, ...)                               \
+  &T::m, RC_INTERNAL_EXPAND(RC_INTERNAL_MEMBER_POINTERS_8(T, __VA_ARGS__))
+#define RC_INTERNAL_MEMBER_POINTERS_10(T, m, ...)                              \
+  &T::m, RC_INTERNAL_EXPAND(RC_INTERNAL_MEMBER_POINTERS_9(T, __VA_ARGS__))
+#define RC_INTERNAL_MEMBER_POINTERS_11(T, m, ...)                              \
+  &T::m, RC_INTERNAL_EXPAND(RC_INTERNAL_MEMBER_POINTERS_10(T, __VA_ARGS__))
+#define RC_INTERNAL_MEMBER_POINTERS_12(T, m, ...)                              \
+  &T::m, RC_INTERNAL_EXPAND(RC_INTERNAL_MEMBER_POINTERS_11(T, __VA_ARGS__))
+#define RC_INTERNAL_MEMBER_POINTERS_13(T, m, ...)                              \
+  &T::m, RC_INTERNAL_EXPAND(RC_INTERNAL_MEMBER_POINTERS_12(T, __VA_ARGS__))
+#define RC_INTERNAL_MEMBER_POINTERS_14(T, m, ...)                              \
+  &T::m, RC_INTERNAL_EXPAND(RC_INTERNAL_MEMBER_POINTERS_13(T, __VA_ARGS__))
+#define RC_INTERNAL_MEMBER_POINTERS_15(T, m, ...)                              \
+  &T::m, RC_INTERNAL_EXPAND(RC_INTERNAL_MEMBER_POINTERS_14(T, __VA_ARGS__))
+#define RC_INTERNAL_MEMBER_POINTERS_16(T, m, ...)                              \
+  &T::m, RC_INTERNAL_EXPAND(RC_INTERNAL_MEMBER_POINTERS_15(T, __VA_ARGS__))
+#define RC_INTERNAL_MEMBER_POINTERS_17(T, m, ...)                              \
+  &T::m, RC_INTERNAL_EXPAND(RC_INTERNAL_MEMBER_POINTERS_16(T, __VA_ARGS__))
+#define RC_INTERNAL_MEMBER_POINTERS_18(T, m, ...)                              \
+  &T::m, RC_INTERNAL_EXPAND(RC_INTERNAL_MEMBER_POINTERS_17(T, __VA_ARGS__))
+#define RC_INTERNAL_MEMBER_POINTERS_19(T, m, ...)                              \
+  &T::m, RC_INTERNAL_EXPAND(RC_INTERNAL_MEMBER_POINTERS_18(T, __VA_ARGS__))
+#define RC_INTERNAL_MEMBER_POINTERS_20(T, m, ...)                              \
+  &T::m, RC_INTERNAL_EXPAND(RC_INTERNAL_MEMBER_POINTERS_19(T, __VA_ARGS__))
+#define RC_INTERNAL_MEMBER_POINTERS_21(T, m, ...)                              \
+  &T::m, RC_INTERNAL_EXPAND(RC_INTERNAL_MEMBER_POINTERS_20(T, __VA_ARGS__))
+#define RC_INTERNAL_MEMBER_POINTERS_22(T, m, ...)                              \
+  &T::m, RC_INTERNAL_EXPAND(RC_INTERNAL_MEMBER_POINTERS_21(T, __VA_ARGS__))
+#define RC_INTERNAL_MEMBER_POINTERS_23(T, m, ...)                              \
+  &T::m, RC_INTERNAL_EXPAND(RC_INTERNAL_MEMBER_POINTERS_22(T, __VA_ARGS__))
+#define RC_INTERNAL_MEMBER_POINTERS_24(T, m, ...)                              \
+  &T::m, RC_INTERNAL_EXPAND(RC_INTERNAL_MEMBER_POINTERS_23(T, __VA_ARGS__))
+#define RC_INTERNAL_MEMBER_POINTERS_25(T, m, ...)                              \
+  &T::m, RC_INTERNAL_EXPAND(RC_INTERNAL_MEMBER_POINTERS_24(T, __VA_ARGS__))
+#define RC_INTERNAL_MEMBER_POINTERS_26(T, m, ...)                              \
+  &T::m, RC_INTERNAL_EXPAND(RC_INTERNAL_MEMBER_POINTERS_25(T, __VA_ARGS__))
+#define RC_INTERNAL_MEMBER_POINTERS_27(T, m, ...)                              \
+  &T::m, RC_INTERNAL_EXPAND(RC_INTERNAL_MEMBER_POINTERS_26(T, __VA_ARGS__))
+#define RC_INTERNAL_MEMBER_POINTERS_28(T, m, ...)                              \
+  &T::m, RC_INTERNAL_EXPAND(RC_INTERNAL_MEMBER_POINTERS_27(T, __VA_ARGS__))
+#define RC_INTERNAL_MEMBER_POINTERS_29(T, m, ...)                              \
+  &T::m, RC_INTERNAL_EXPAND(RC_INTERNAL_MEMBER_POINTERS_28(T, __VA_ARGS__))
+#define RC_INTERNAL_MEMBER_POINTERS_30(T, m, ...)                              \
+  &T::m, RC_INTERNAL_EXPAND(RC_INTERNAL_MEMBER_POINTERS_29(T, __VA_ARGS__))
+#define RC_INTERNAL_MEMBER_POINTERS_31(T, m, ...)                              \
+  &T::m, RC_INTERNAL_EXPAND(RC_INTERNAL_MEMBER_POINTERS_30(T, __VA_ARGS__))
+#define RC_INTERNAL_MEMBER_POINTERS_32(T, m, ...)                              \
+  &T::m, RC_INTERNAL_EXPAND(RC_INTERNAL_MEMBER_POINTERS_31(T, __VA_ARGS__))
+#define RC_INTERNAL_MEMBER_POINTERS_33(T, m, ...)                              \
+  &T::m, RC_INTERNAL_EXPAND(RC_INTERNAL_MEMBER_POINTERS_32(T, __VA_ARGS__))
+#define RC_INTERNAL_MEMBER_POINTERS_34(T, m, ...)                              \
+  &T::m, RC_INTERNAL_EXPAND(RC_INTERNAL_MEMBER_POINTERS_33(T, __VA_ARGS__))
+#define RC_INTERNAL_MEMBER_POINTERS_35(T, m, ...)                              \
+  &T::m, RC_INTERNAL_EXPAND(RC_INTERNAL_MEMBER_POINTERS_34(T, __VA_ARGS__))
+#define RC_INTERNAL_MEMBER_POINTERS_36(T, m, ...)                              \
+  &T::m, RC_INTERNAL_EXPAND(RC_INTERNAL_MEMBER_POINTERS_35(T, __VA_ARGS__))
+#define RC_INTERNAL_MEMBER_POINTERS_37(T, m, ...)                              \
+  &T::m, RC_INTERNAL_EXPAND(RC_INTERNAL_MEMBER_POINTERS_36(T, __VA_ARGS__))
+#define RC_INTERNAL_MEMBER_POINTERS_38(T, m, ...)                              \
+  &T::m, RC_INTERNAL_EXPAND(RC_INTERNAL_MEMBER_POINTERS_37(T, __VA_ARGS__))
+#define RC_INTERNAL_MEMBER_POINTERS_39(T, m, ...)                              \
+  &T::m, RC_INTERNAL_EXPAND(RC_INTERNAL_MEMBER_POINTERS_38(T, __VA_ARGS__))
+#define RC_INTERNAL_MEMBER_POINTERS_40(T, m, ...)                              \
+  &T::m, RC_INTERNAL_EXPAND(RC_INTERNAL_MEMBER_POINTERS_39(T, __VA_ARGS__))
+#define RC_INTERNAL_MEMBER_POINTERS_41(T, m, ...)                              \
+  &T::m, RC_INTERNAL_EXPAND(RC_INTERNAL_MEMBER_POINTERS_40(T, __VA_ARGS__))
+#define RC_INTERNAL_MEMBER_POINTERS_42(T, m, ...)                              \
+  &T::m, RC_INTERNAL_EXPAND(RC_INTERNAL_MEMBER_POINTERS_41(T, __VA_ARGS__))
+#define RC_INTERNAL_MEMBER_POINTERS_43(T, m, ...)                              \
+  &T::m, RC_INTERNAL_EXPAND(RC_INTERNAL_MEMBER_POINTERS_42(T, __VA_ARGS__))
+#define RC_INTERNAL_MEMBER_POINTERS_44(T, m, ...)                              \
+  &T::m, RC_INTERNAL_EXPAND(RC_INTERNAL_MEMBER_POINTERS_43(T, __VA_ARGS__))
+#define RC_INTERNAL_MEMBER_POINTERS_45(T, m, ...)                              \
+  &T::m, RC_INTERNAL_EXPAND(RC_INTERNAL_MEMBER_POINTERS_44(T, __VA_ARGS__))
+#define RC_INTERNAL_MEMBER_POINTERS_46(T, m, ...)                              \
+  &T::m, RC_INTERNAL_EXPAND(RC_INTERNAL_MEMBER_POINTERS_45(T, __VA_ARGS__))
+#define RC_INTERNAL_MEMBER_POINTERS_47(T, m, ...)                              \
+  &T::m, RC_INTERNAL_EXPAND(RC_INTERNAL_MEMBER_POINTERS_46(T, __VA_ARGS__))
+#define RC_INTERNAL_MEMBER_POINTERS_48(T, m, ...)                              \
+  &T::m, RC_INTERNAL_EXPAND(RC_INTERNAL_MEMBER_POINTERS_47(T, __VA_ARGS__))
+#define RC_INTERNAL_MEMBER_POINTERS_49(T, m, ...)                              \
+  &T::m, RC_INTERNAL_EXPAND(RC_INTERNAL_MEMBER_POINTERS_48(T, __VA_ARGS__))
+#define RC_INTERNAL_MEMBER_POINTERS_50(T, m, ...)                              \
+  &T::m, RC_INTERNAL_EXPAND(RC_INTERNAL_MEMBER_POINTERS_49(T, __VA_ARGS__))
+#define RC_INTERNAL_MEMBER_POINTERS_51(T, m, ...)                              \
+  &T::m, RC_INTERNAL_EXPAND(RC_INTERNAL_MEMBER_POINTERS_50(T, __VA_ARGS__))
+#define RC_INTERNAL_MEMBER_POINTERS_52(T, m, ...)                              \
+  &T::m, RC_INTERNAL_EXPAND(RC_INTERNAL_MEMBER_POINTERS_51(T, __VA_ARGS__))
+#define RC_INTERNAL_MEMBER_POINTERS_53(T, m, ...)                              \
+  &T::m, RC_INTERNAL_EXPAND(RC_INTERNAL_MEMBER_POINTERS_52(T, __VA_ARGS__))
+#define RC_INTERNAL_MEMBER_POINTERS_54(T, m, ...)                              \
+  &T::m, RC_INTERNAL_EXPAND(RC_INTERNAL_MEMBER_POINTERS_53(T, __VA_ARGS__))
+#define RC_INTERNAL_MEMBER_POINTERS_55(T, m, ...)                              \
+  &T::m, RC_INTERNAL_EXPAND(RC_INTERNAL_MEMBER_POINTERS_54(T, __VA_ARGS__))
+#define RC_INTERNAL_MEMBER_POINTERS_56(T, m, ...)                              \
+  &T::m, RC_INTERNAL_EXPAND(RC_INTERNAL_MEMBER_POINTERS_55(T, __VA_ARGS__))
+#define RC_INTERNAL_MEMBER_POINTERS_57(T, m, ...)                              \
+  &T::m, RC_INTERNAL_EXPAND(RC_INTERNAL_MEMBER_POINTERS_56(T, __VA_ARGS__))
+#define RC_INTERNAL_MEMBER_POINTERS_58(T, m, ...)                              \
+  &T::m, RC_INTERNAL_EXPAND(RC_INTERNAL_MEMBER_POINTERS_57(T, __VA_ARGS__))
+#define RC_INTERNAL_MEMBER_POINTERS_59(T, m, ...)                              \
+  &T::m, RC_INTERNAL_EXPAND(RC_INTERNAL_MEMBER_POINTERS_58(T, __VA_ARGS__))
+#define RC_INTERNAL_MEMBER_POINTERS_60(T, m, ...)                              \
+  &T::m, RC_INTERNAL_EXPAND(RC_INTERNAL_MEMBER_POINTERS_59(T, __VA_ARGS__))
+#define RC_INTERNAL_MEMBER_POINTERS_61(T, m, ...)                              \
+  &T::m, RC_INTERNAL_EXPAND(RC_INTERNAL_MEMBER_POINTERS_60(T, __VA_ARGS__))
+#define RC_INTERNAL_MEMBER_POINTERS_62(T, m, ...)                              \
+  &T::m, RC_INTERNAL_EXPAND(RC_INTERNAL_MEMBER_POINTERS_61(T, __VA_ARGS__))
+#define RC_INTERNAL_MEMBER_POINTERS_63(T, m, ...)                              \
+  &T::m, RC_INTERNAL_EXPAND(RC_INTERNAL_MEMBER_POINTERS_62(T, __VA_ARGS__))
+#define RC_INTERNAL_MEMBER_POINTERS_64(T, m, ...)                              \
+  &T::m, RC_INTERNAL_EXPAND(RC_INTERNAL_MEMBER_POINTERS_63(T, __VA_ARGS__))
@@ -11,6 +11,17 @@
     "You need to implement RC_INTERNAL_DEPRECATED for this compiler")
 #endif
 
+#if defined(__GNUC__)
+#define RC_INTERNAL_UNLIKELY(x) __builtin_expect(!!(x), 0)
+#define RC_INTERNAL_NOINLINE __attribute__((noinline))
+#elif defined(_MSC_VER)
+#define RC_INTERNAL_UNLIKELY(x) (x)
+#define RC_INTERNAL_NOINLINE __declspec(noinline)
+#else
+#define RC_INTERNAL_UNLIKELY(x) (x)
+#define RC_INTERNAL_NOINLINE
+#endif
+
 namespace rc {
 namespace detail {
 
@@ -2,7 +2,9 @@
 
 #include <functional>
 
+#include "rapidcheck/Complexity.h"
 #include "rapidcheck/Gen.h"
+#include "rapidcheck/Maybe.h"
 #include "rapidcheck/detail/Results.h"
 
 namespace rc {
@@ -11,6 +13,10 @@ namespace detail {
 struct CaseDescription {
   CaseResult result;
   std::vector<std::string> tags;
+  /// The highest value reported using `RC_TARGET`, if any.
+  Maybe<double> target;
+  /// The last measurement made using `RC_COMPLEXITY`, if any.
+  Maybe<ComplexitySample> complexity;
   std::function<Example()> example;
 };
 
@@ -1,5 +1,8 @@
 #pragma once
 
+#include <memory>
+#include <sstream>
+
 #include "rapidcheck/detail/FunctionTraits.h"
 #include "rapidcheck/gen/detail/ExecRaw.h"
 #include "rapidcheck/detail/PropertyContext.h"
@@ -10,6 +13,8 @@ namespace detail {
 struct TaggedResult {
   CaseResult result;
   Tags tags;
+  Maybe<double> target;
+  Maybe<ComplexitySample> complexity;
 };
 
 class AdapterContext : public PropertyContext {
@@ -19,13 +24,41 @@ public:
   bool reportResult(const CaseResult &result) override;
   std::ostream &logStream() override;
   void addTag(std::string str) override;
-  TaggedResult result() const;
+  void addTarget(double value) override;
+  void addComplexitySample(const ComplexitySample &sample) override;
+
+  /// Moves the accumulated result out of this context. The context should be
+  /// `reset` before it is used again.
+  TaggedResult result();
+
+  /// Resets this context to its initial state while keeping any allocated
+  /// buffers around for reuse.
+  void reset();
 
 private:
   CaseResult::Type m_resultType;
   std::vector<std::string> m_messages;
-  std::ostringstream m_logStream;
+  // Created on first use since most properties never log anything
+  std::unique_ptr<std::ostringstream> m_logStream;
   Tags m_tags;
+  Maybe<double> m_target;
+  Maybe<ComplexitySample> m_complexity;
+};
+
+/// Lends out an `AdapterContext` for the lifetime of this object. Contexts are
+/// recycled between test cases so that the fixed cost of running a trivial
+/// property stays low. Nested properties will each receive a separate context.
+class ScopedAdapterContext {
+public:
+  ScopedAdapterContext();
+  ~ScopedAdapterContext();
+
+  AdapterContext &context() { return *m_context; }
+
+private:
+  RC_DISABLE_COPY(ScopedAdapterContext)
+
+  AdapterContext *m_context;
 };
 
 CaseResult toCaseResult(bool value);
@@ -63,7 +96,8 @@ public:
       : m_callable(std::forward<Arg>(callable)) {}
 
   TaggedResult operator()(Args &&... args) const {
-    AdapterContext context;
+    ScopedAdapterContext scopedContext;
+    auto &context = scopedContext.context();
     ImplicitParam<param::CurrentPropertyContext> letContext(&context);
 
     try {
@@ -93,6 +127,11 @@ private:
   Callable m_callable;
 };
 
+/// Returns the description and the shown value of the given ingredient as they
+/// appear in counterexamples.
+std::pair<std::string, std::string>
+describeIngredient(const gen::detail::Recipe::Ingredient &ingredient);
+
 Gen<CaseDescription>
 mapToCaseDescription(Gen<std::pair<TaggedResult, gen::detail::Recipe>> gen);
 
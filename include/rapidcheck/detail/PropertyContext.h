@@ -3,6 +3,7 @@
 #include <string>
 #include <iostream>
 
+#include "rapidcheck/Complexity.h"
 #include "rapidcheck/detail/Results.h"
 
 namespace rc {
@@ -26,6 +27,14 @@ public:
   /// Adds a tag to the current scope.
   virtual void addTag(std::string str) = 0;
 
+  /// Reports a value that the search should try to maximize. Ignored by
+  /// default.
+  virtual void addTarget(double /*value*/) {}
+
+  /// Reports a measurement of how the runtime depends on the input size.
+  /// Ignored by default.
+  virtual void addComplexitySample(const ComplexitySample & /*sample*/) {}
+
   virtual ~PropertyContext() = default;
 };
 
@@ -3,6 +3,8 @@
 #include <vector>
 #include <map>
 
+#include "rapidcheck/Complexity.h"
+#include "rapidcheck/Maybe.h"
 #include "rapidcheck/Random.h"
 #include "rapidcheck/detail/Variant.h"
 
@@ -48,6 +50,9 @@ struct Reproduce {
   int size;
   /// The shrink path to follow.
   std::vector<std::size_t> shrinkPath;
+  /// If not empty, the values drawn from `Random` to replay instead of
+  /// following the shrink path. Used for failures shrunk by their choices.
+  std::vector<std::uint64_t> choices;
 };
 
 std::ostream &operator<<(std::ostream &os, const detail::Reproduce &r);
@@ -59,12 +64,30 @@ Iterator serialize(const Reproduce &value, Iterator output);
 template <typename Iterator>
 Iterator deserialize(Iterator begin, Iterator end, Reproduce &out);
 
+/// The highest value reported using `RC_TARGET` and the test case that
+/// reported it.
+struct TargetResult {
+  /// The value.
+  double value;
+  /// The test case that reported the value.
+  Example example;
+};
+
+std::ostream &operator<<(std::ostream &os, const detail::TargetResult &result);
+bool operator==(const TargetResult &r1, const TargetResult &r2);
+bool operator!=(const TargetResult &r1, const TargetResult &r2);
+
 /// Indicates a successful property.
 struct SuccessResult {
   /// The number of successful tests run.
   int numSuccess;
   /// The test case distribution. This is a map from tags to count.
   Distribution distribution;
+  /// The highest target value if the property uses `RC_TARGET`.
+  Maybe<TargetResult> target;
+  /// The complexity class that best fits the runtime if the property uses
+  /// `RC_COMPLEXITY`.
+  Maybe<Complexity> complexity;
 };
 
 std::ostream &operator<<(std::ostream &os, const detail::SuccessResult &result);
@@ -77,8 +100,9 @@ struct FailureResult {
   int numSuccess;
   /// A description of the failure.
   std::string description;
-  /// The information required to reproduce the failure.
-  Reproduce reproduce;
+  /// The information required to reproduce the failure. Not set for failures
+  /// that no single test case reproduces, such as a violated complexity bound.
+  Maybe<Reproduce> reproduce;
   /// The counterexample.
   Example counterExample;
 };
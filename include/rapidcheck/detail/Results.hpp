@@ -9,6 +9,7 @@ Iterator serialize(const Reproduce &value, Iterator output) {
   oit = serialize(value.random, oit);
   oit = serialize(static_cast<std::uint32_t>(value.size), oit);
   oit = serializeCompact(begin(value.shrinkPath), end(value.shrinkPath), oit);
+  oit = serializeCompact(begin(value.choices), end(value.choices), oit);
   return oit;
 }
 
@@ -24,8 +25,13 @@ Iterator deserialize(Iterator begin, Iterator end, Reproduce &out) {
   out.shrinkPath.clear();
   const auto p = deserializeCompact<std::size_t>(
       iit, end, std::back_inserter(out.shrinkPath));
+  iit = p.first;
 
-  return p.first;
+  out.choices.clear();
+  const auto q = deserializeCompact<std::uint64_t>(
+      iit, end, std::back_inserter(out.choices));
+
+  return q.first;
 }
 
 } // namespace detail
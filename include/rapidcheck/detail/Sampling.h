@@ -0,0 +1,19 @@
+#pragma once
+
+#include <cstdint>
+#include <vector>
+
+#include "rapidcheck/Random.h"
+
+namespace rc {
+namespace detail {
+
+/// Returns `k` distinct integers from `[0, n)` in uniformly random order. This
+/// is a Fisher-Yates shuffle which stops after `k` steps and only keeps track
+/// of the swapped positions when `n` is large compared to `k` so it runs in
+/// O(k) time and space without ever retrying. `k` must not be larger than `n`.
+std::vector<std::uint64_t>
+sampleWithoutReplacement(Random &random, std::uint64_t n, std::size_t k);
+
+} // namespace detail
+} // namespace rc
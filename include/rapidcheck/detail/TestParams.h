@@ -6,6 +6,47 @@
 namespace rc {
 namespace detail {
 
+/// Strategies for choosing the size of each test case.
+enum class SizeSchedule {
+  /// Sizes are spread evenly between `0` and the maximum size.
+  Linear,
+  /// Sizes ramp up quickly towards the maximum size so that less of the
+  /// budget is spent on trivially small inputs.
+  Exponential,
+  /// After an initial linear sweep, cases are spent on the sizes that have
+  /// produced new tags and few discards.
+  Adaptive
+};
+
+std::ostream &operator<<(std::ostream &os, SizeSchedule schedule);
+std::istream &operator>>(std::istream &is, SizeSchedule &schedule);
+
+/// Strategies for shrinking failing test cases.
+enum class ShrinkEngine {
+  /// Shrinks are taken from the `Shrinkable` trees of the generators.
+  Tree,
+  /// The values drawn from `Random` while generating the test case are
+  /// recorded and shrinking operates on those which are then replayed. This
+  /// works uniformly for all generators. `reproduce` strings contain the
+  /// shrunk choices.
+  Choices
+};
+
+std::ostream &operator<<(std::ostream &os, ShrinkEngine engine);
+std::istream &operator>>(std::istream &is, ShrinkEngine &engine);
+
+/// Strategies for running test cases.
+enum class CaseIsolation {
+  /// Test cases run in the testing process.
+  None,
+  /// Each test case runs in a forked child process so that it can be stopped
+  /// when it times out.
+  Fork
+};
+
+std::ostream &operator<<(std::ostream &os, CaseIsolation isolation);
+std::istream &operator>>(std::istream &is, CaseIsolation &isolation);
+
 /// Describes the parameters for a test.
 struct TestParams {
   /// The seed to use.
@@ -18,6 +59,30 @@ struct TestParams {
   int maxDiscardRatio = 10;
   /// Whether shrinking should be disabled or not.
   bool disableShrinking = false;
+  /// The strategy used to shrink failing test cases.
+  ShrinkEngine shrinkEngine = ShrinkEngine::Tree;
+  /// The strategy used to choose the size of each test case.
+  SizeSchedule sizeSchedule = SizeSchedule::Linear;
+  /// Whether test cases that reach new SanitizerCoverage counters should be
+  /// mutated to produce further test cases.
+  bool coverageGuided = false;
+  /// Whether a failing property should stop all other properties that also
+  /// have this enabled.
+  bool failFast = false;
+  /// The index of the shard to run, must be less than `shardCount`.
+  int shardIndex = 0;
+  /// The number of shards the test cases are split into. Each shard starts its
+  /// test cases from every `shardCount`th seed of the sequence that would be
+  /// used without sharding.
+  int shardCount = 1;
+  /// The number of milliseconds a single test case may run for or `0` for no
+  /// limit.
+  int caseTimeoutMs = 0;
+  /// How test cases are run.
+  CaseIsolation isolation = CaseIsolation::None;
+  /// The maximum size in megabytes of the address space of an isolated test
+  /// case or `0` for no limit.
+  int memoryLimitMb = 0;
 };
 
 bool operator==(const TestParams &p1, const TestParams &p2);
@@ -0,0 +1,42 @@
+#pragma once
+
+#include "rapidcheck/Gen.h"
+#include "rapidcheck/detail/MemberPointers.h"
+
+namespace rc {
+namespace gen {
+
+/// Generates objects of type `T` by value initializing them and then
+/// assigning an arbitrary value to each of the given data members. Unlike
+/// `gen::build`, all members are kept in a single flat shrinkable which shrinks
+/// one member at a time in place instead of going through nested `gen::map`
+/// and tuple shrinkables. This makes it cheap to generate structs with many
+/// members. If no members are given, the value initialized object is always
+/// generated.
+template <typename T, typename... Ms>
+Gen<T> aggregate(Ms T::*... members);
+
+} // namespace gen
+} // namespace rc
+
+/// Specializes `rc::Arbitrary` for the aggregate type `Type` using
+/// `gen::aggregate` with the listed data members. Must be used at global
+/// namespace scope. `Type` may not contain unparenthesized commas, use a type
+/// alias for such types.
+///
+/// ```
+/// struct Message { int id; std::string body; };
+/// RC_DERIVE_ARBITRARY(Message, id, body)
+/// ```
+#define RC_DERIVE_ARBITRARY(Type, ...)                                         \
+  namespace rc {                                                               \
+  template <>                                                                  \
+  struct Arbitrary<Type> {                                                     \
+    static Gen<Type> arbitrary() {                                             \
+      return gen::aggregate<Type>(                                             \
+          RC_INTERNAL_MEMBER_POINTERS(Type, __VA_ARGS__));                     \
+    }                                                                          \
+  };                                                                           \
+  }
+
+#include "Aggregate.hpp"
@@ -0,0 +1,173 @@
+#pragma once
+
+#include <memory>
+
+#include "rapidcheck/shrinkable/Create.h"
+#include "rapidcheck/seq/Transform.h"
+#include "rapidcheck/gen/Arbitrary.h"
+#include "rapidcheck/detail/IntSequence.h"
+#include "rapidcheck/Random.h"
+
+namespace rc {
+namespace gen {
+namespace detail {
+
+// Aggregates are shrunk like tuples, see Tuple.hpp. In addition, the state
+// caches the generated object so that a shrink copies it and assigns only the
+// member that changed through its member pointer.
+
+template <typename T, typename... Ms>
+struct AggregateState {
+  /// The current value, kept in sync with the value of each field.
+  T value;
+  std::tuple<Shrinkable<Ms>...> fields;
+  std::tuple<Ms T::*...> members;
+};
+
+template <typename T, typename... Ms>
+using AggregateStatePtr = std::shared_ptr<const AggregateState<T, Ms...>>;
+
+template <typename Indexes, typename T, typename... Ms>
+class AggregateShrinkable;
+
+template <std::size_t I, typename Indexes, typename T, typename... Ms>
+class AggregateMemberShrinkable;
+
+template <typename Indexes, typename T, typename... Ms>
+class AggregateGen;
+
+template <std::size_t I, typename Indexes, typename T, typename... Ms>
+class AggregateShrinkSeq {
+public:
+  using M = typename std::tuple_element<I, std::tuple<Ms...>>::type;
+
+  explicit AggregateShrinkSeq(AggregateStatePtr<T, Ms...> state)
+      : m_state(std::move(state))
+      , m_shrinks(std::get<I>(m_state->fields).shrinks()) {}
+
+  Maybe<Shrinkable<T>> operator()() {
+    auto shrink = m_shrinks.next();
+    if (!shrink) {
+      m_shrinks = Seq<Shrinkable<M>>();
+      return Nothing;
+    }
+
+    using ShrinkableImpl = AggregateMemberShrinkable<I, Indexes, T, Ms...>;
+    return makeShrinkable<ShrinkableImpl>(m_state, std::move(*shrink));
+  }
+
+private:
+  AggregateStatePtr<T, Ms...> m_state;
+  Seq<Shrinkable<M>> m_shrinks;
+};
+
+template <typename T, typename... Ms, std::size_t... Indexes>
+class AggregateShrinkable<rc::detail::IndexSequence<Indexes...>, T, Ms...> {
+public:
+  explicit AggregateShrinkable(AggregateStatePtr<T, Ms...> state)
+      : m_state(std::move(state)) {}
+
+  T value() const { return m_state->value; }
+
+  Seq<Shrinkable<T>> shrinks() const {
+    using IndexSeq = rc::detail::IndexSequence<Indexes...>;
+    return seq::concat(
+        makeSeq<AggregateShrinkSeq<Indexes, IndexSeq, T, Ms...>>(m_state)...);
+  }
+
+private:
+  AggregateStatePtr<T, Ms...> m_state;
+};
+
+/// A shrink of an aggregate where only member `I` differs from the shared
+/// state.
+template <std::size_t I, typename T, typename... Ms, std::size_t... Indexes>
+class AggregateMemberShrinkable<I,
+                                rc::detail::IndexSequence<Indexes...>,
+                                T,
+                                Ms...> {
+public:
+  using M = typename std::tuple_element<I, std::tuple<Ms...>>::type;
+
+  AggregateMemberShrinkable(AggregateStatePtr<T, Ms...> state,
+                            Shrinkable<M> member)
+      : m_state(std::move(state))
+      , m_member(std::move(member)) {}
+
+  T value() const {
+    T value = m_state->value;
+    value.*std::get<I>(m_state->members) = m_member.value();
+    return value;
+  }
+
+  Seq<Shrinkable<T>> shrinks() const {
+    auto state = *m_state;
+    state.value.*std::get<I>(state.members) = m_member.value();
+    std::get<I>(state.fields) = m_member;
+    using IndexSeq = rc::detail::IndexSequence<Indexes...>;
+    return AggregateShrinkable<IndexSeq, T, Ms...>(
+               std::make_shared<const AggregateState<T, Ms...>>(
+                   std::move(state)))
+        .shrinks();
+  }
+
+private:
+  AggregateStatePtr<T, Ms...> m_state;
+  Shrinkable<M> m_member;
+};
+
+template <typename T, typename... Ms, std::size_t... Indexes>
+class AggregateGen<rc::detail::IndexSequence<Indexes...>, T, Ms...> {
+public:
+  explicit AggregateGen(Ms T::*... members)
+      : m_members(members...)
+      , m_gens(gen::arbitrary<Ms>()...) {}
+
+  Shrinkable<T> operator()(const Random &random, int size) const {
+    auto r = random;
+    Random randoms[sizeof...(Ms)];
+    for (std::size_t i = 0; i < sizeof...(Ms); i++) {
+      randoms[i] = r.split();
+    }
+
+    std::tuple<Shrinkable<Ms>...> fields(
+        std::get<Indexes>(m_gens)(randoms[Indexes], size)...);
+    T value = T();
+    int dummy[] = {(value.*std::get<Indexes>(m_members) =
+                        std::get<Indexes>(fields).value(),
+                    0)...};
+    static_cast<void>(dummy);
+
+    using ShrinkableImpl =
+        AggregateShrinkable<rc::detail::IndexSequence<Indexes...>, T, Ms...>;
+    return makeShrinkable<ShrinkableImpl>(
+        std::make_shared<const AggregateState<T, Ms...>>(
+            AggregateState<T, Ms...>{
+                std::move(value), std::move(fields), m_members}));
+  }
+
+private:
+  std::tuple<Ms T::*...> m_members;
+  std::tuple<Gen<Ms>...> m_gens;
+};
+
+// Specialization for when no members are given.
+template <typename T>
+class AggregateGen<rc::detail::IndexSequence<>, T> {
+public:
+  Shrinkable<T> operator()(const Random & /*random*/, int /*size*/) const {
+    return shrinkable::just(T());
+  }
+};
+
+} // namespace detail
+
+template <typename T, typename... Ms>
+Gen<T> aggregate(Ms T::*... members) {
+  return detail::AggregateGen<rc::detail::MakeIndexSequence<sizeof...(Ms)>,
+                              T,
+                              Ms...>(members...);
+}
+
+} // namespace gen
+} // namespace rc
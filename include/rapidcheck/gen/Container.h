@@ -24,6 +24,25 @@ Gen<Container> unique(Gen<T> gen);
 template <typename Container, typename T, typename F>
 Gen<Container> uniqueBy(Gen<T> gen, F &&f);
 
+/// Generates a container of unique integers in the range `[min, max)`. Unlike
+/// `gen::unique(gen::inRange(min, max))`, the values are sampled without
+/// replacement so generation never has to retry because of collisions, even
+/// when the container fills most of the range. If there are more elements than
+/// values in the range, the container will contain the entire range.
+template <typename Container, typename T>
+Gen<Container> uniqueInRange(T min, T max);
+
+/// Same as `gen::uniqueInRange` but with explicitly requested container size.
+/// Throws a `GenerationFailure` if `count` is larger than the range.
+template <typename Container, typename T>
+Gen<Container> uniqueInRange(std::size_t count, T min, T max);
+
+/// Generates permutations of the elements of the given container using a
+/// Fisher-Yates shuffle. Shrinks towards the original order by reducing the
+/// number of elements that are out of order.
+template <typename Container>
+Gen<Decay<Container>> permutationOf(Container &&container);
+
 } // namespace gen
 } // namespace rc
 
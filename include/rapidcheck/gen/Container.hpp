@@ -1,7 +1,10 @@
 #pragma once
 
+#include "rapidcheck/detail/BoundedRandom.h"
+#include "rapidcheck/detail/Sampling.h"
 #include "rapidcheck/gen/Arbitrary.h"
 #include "rapidcheck/gen/Tuple.h"
+#include "rapidcheck/gen/detail/ScaleInteger.h"
 #include "rapidcheck/gen/detail/ShrinkValueIterator.h"
 #include "rapidcheck/shrink/Shrink.h"
 #include "rapidcheck/shrinkable/Create.h"
@@ -13,6 +16,7 @@ namespace detail {
 
 RC_SFINAE_TRAIT(IsAssociativeContainer, typename T::key_type)
 RC_SFINAE_TRAIT(IsMapContainer, typename T::mapped_type)
+RC_SFINAE_TRAIT(HasIndependentElements, typename T::IndependentElements)
 
 template <typename T>
 using Shrinkables = std::vector<Shrinkable<T>>;
@@ -61,6 +65,14 @@ Shrinkables<T> generateShrinkables(const Random &random,
 template <typename Container>
 class CollectionStrategy {
 public:
+  /// Elements are shrunk independently of each other.
+  using IndependentElements = std::true_type;
+
+  template <typename T>
+  static Seq<Shrinkable<T>> shrinkElement(const Shrinkable<T> &s) {
+    return s.shrinks();
+  }
+
   template <typename T>
   Shrinkables<T> generateElements(const Random &random,
                                   int size,
@@ -71,8 +83,7 @@ public:
 
   template <typename T>
   Seq<Shrinkables<T>> shrinkElements(const Shrinkables<T> &shrinkables) const {
-    return shrink::eachElement(
-        shrinkables, [](const Shrinkable<T> &s) { return s.shrinks(); });
+    return shrink::eachElement(shrinkables, &shrinkElement<T>);
   }
 };
 
@@ -284,6 +295,63 @@ private:
   F m_f;
 };
 
+template <typename T>
+class UniqueInRangeStrategy {
+public:
+  UniqueInRangeStrategy(T min, T max, bool fixedCount)
+      : m_min(min)
+      , m_max(max)
+      , m_fixedCount(fixedCount) {}
+
+  Shrinkables<T>
+  generateElements(const Random &random, int size, std::size_t count) const {
+    if (m_max <= m_min) {
+      throw GenerationFailure("Invalid range [" + std::to_string(m_min) +
+                              ", " + std::to_string(m_max) + ")");
+    }
+
+    const auto fullRange = static_cast<Random::Number>(m_max) -
+        static_cast<Random::Number>(m_min);
+    if (count > fullRange) {
+      if (m_fixedCount) {
+        throw GenerationFailure("Cannot generate " + std::to_string(count) +
+                                " unique values in range [" +
+                                std::to_string(m_min) + ", " +
+                                std::to_string(m_max) + ")");
+      }
+      count = static_cast<std::size_t>(fullRange);
+    }
+
+    // Like gen::inRange, the part of the range that is used grows with size
+    // but it must always be large enough to fit all the values.
+    const auto rangeSize =
+        std::max<Random::Number>(scaleInteger(fullRange - 1, size) + 1, count);
+
+    Random r(random);
+    const auto offsets =
+        rc::detail::sampleWithoutReplacement(r, rangeSize, count);
+    const auto min = m_min;
+    Shrinkables<T> shrinkables;
+    shrinkables.reserve(count);
+    for (const auto offset : offsets) {
+      shrinkables.push_back(
+          shrinkable::shrinkRecur(static_cast<T>(offset + m_min), [=](T x) {
+            return shrink::towards<T>(x, min);
+          }));
+    }
+    return shrinkables;
+  }
+
+  Seq<Shrinkables<T>> shrinkElements(const Shrinkables<T> &shrinkables) const {
+    return GenericContainerStrategy<std::set<T>>().shrinkElements(shrinkables);
+  }
+
+private:
+  T m_min;
+  T m_max;
+  bool m_fixedCount;
+};
+
 template <typename Container, typename Strategy>
 class ContainerHelper {
 public:
@@ -295,17 +363,15 @@ public:
   generate(const Random &random, int size, const Gen<Ts> &... gens) const {
     const auto strategy = m_strategy;
     auto r = random;
-    std::size_t count = r.split().next() % (size + 1);
+    const auto count =
+        static_cast<std::size_t>(rc::detail::nextBounded(r.split(), size + 1));
     auto shrinkables = strategy.generateElements(r, size, count, gens...);
 
     using Elements = decltype(shrinkables);
     return shrinkable::map(
-        shrinkable::shrinkRecur(std::move(shrinkables),
-                                [=](const Elements &elements) {
-                                  return seq::concat(
-                                      shrink::removeChunks(elements),
-                                      strategy.shrinkElements(elements));
-                                }),
+        shrinkElements(strategy,
+                       std::move(shrinkables),
+                       HasIndependentElements<Strategy>()),
         &toContainer<Container, typename Elements::value_type::ValueType>);
   }
 
@@ -327,6 +393,26 @@ public:
   }
 
 private:
+  template <typename T>
+  static Shrinkable<Shrinkables<T>> shrinkElements(const Strategy &/*strategy*/,
+                                                   Shrinkables<T> &&elements,
+                                                   std::true_type) {
+    // Shrinks only record the edit since elements are independent
+    return shrinkable::shrinkContainer(std::move(elements),
+                                       &Strategy::template shrinkElement<T>);
+  }
+
+  template <typename Elements>
+  static Shrinkable<Elements>
+  shrinkElements(const Strategy &strategy, Elements &&elements, std::false_type) {
+    return shrinkable::shrinkRecur(std::move(elements),
+                                   [=](const Elements &elements) {
+                                     return seq::concat(
+                                         shrink::removeChunks(elements),
+                                         strategy.shrinkElements(elements));
+                                   });
+  }
+
   Strategy m_strategy;
 };
 
@@ -537,5 +623,54 @@ Gen<Container> unique(std::size_t count, Gen<T> gen) {
                                   [](const T &x) -> const T & { return x; });
 }
 
+template <typename Container, typename T>
+Gen<Container> uniqueInRange(T min, T max) {
+  using Strategy = detail::UniqueInRangeStrategy<T>;
+  detail::ContainerHelper<Container, Strategy> helper(
+      Strategy(min, max, false));
+
+  return [=](const Random &random, int size) {
+    return helper.generate(random, size);
+  };
+}
+
+template <typename Container, typename T>
+Gen<Container> uniqueInRange(std::size_t count, T min, T max) {
+  using Strategy = detail::UniqueInRangeStrategy<T>;
+  detail::ContainerHelper<Container, Strategy> helper(
+      Strategy(min, max, true));
+
+  return [=](const Random &random, int size) {
+    return helper.generate(count, random, size);
+  };
+}
+
+template <typename Container>
+Gen<Decay<Container>> permutationOf(Container &&container) {
+  using Result = Decay<Container>;
+  using T = typename Result::value_type;
+  const auto elements = std::make_shared<const std::vector<T>>(
+      begin(container), end(container));
+
+  return [=](const Random &random, int /*size*/) {
+    Random r(random);
+    const auto n = elements->size();
+    const auto offsets = rc::detail::sampleWithoutReplacement(r, n, n);
+    std::vector<std::size_t> indexes(begin(offsets), end(offsets));
+
+    return shrinkable::map(
+        shrinkable::shrinkRecur(std::move(indexes),
+                                &shrink::towardsSorted<std::vector<std::size_t>>),
+        [=](const std::vector<std::size_t> &permutation) {
+          std::vector<T> permuted;
+          permuted.reserve(permutation.size());
+          for (const auto i : permutation) {
+            permuted.push_back((*elements)[i]);
+          }
+          return Result(begin(permuted), end(permuted));
+        });
+  };
+}
+
 } // namespace gen
 } // namespace rc
@@ -1,5 +1,7 @@
 #pragma once
 
+#include "rapidcheck/detail/BoundedRandom.h"
+
 namespace rc {
 namespace gen {
 namespace detail {
@@ -12,7 +14,7 @@ public:
 
   Shrinkable<Maybe<T>> operator()(const Random &random, int size) const {
     auto r = random;
-    const auto x = r.split().next() % (size + 1);
+    const auto x = rc::detail::nextBounded(r.split(), size + 1);
     if (x == 0) {
       return shrinkable::lambda([]{ return Maybe<T>(); });
     }
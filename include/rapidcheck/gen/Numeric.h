@@ -12,6 +12,27 @@ namespace gen {
 template <typename T>
 Gen<T> inRange(T min, T max);
 
+/// The rates at which `gen::real` mixes special values into the values it
+/// generates. Each rate is a probability in `[0, 1]` and they may not add up to
+/// more than `1`. The rest of the values are ordinary normalized values.
+struct RealOptions {
+  /// Rate of NaN.
+  double nanRate = 0.02;
+  /// Rate of positive or negative infinity.
+  double infinityRate = 0.02;
+  /// Rate of denormal (subnormal) values.
+  double denormalRate = 0.05;
+  /// Rate of boundary values such as `max()`, `min()`, `epsilon()` and values
+  /// close to `max()`.
+  double extremeRate = 0.05;
+};
+
+/// Generates a floating point value of type `T` by picking the exponent and
+/// mantissa bits directly so that the full range of magnitudes is covered.
+/// Special values are mixed in according to `options`.
+template <typename T>
+Gen<T> real(const RealOptions &options = RealOptions());
+
 } // namespace gen
 } // namespace rc
 
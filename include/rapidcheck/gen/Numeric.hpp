@@ -1,6 +1,12 @@
 #pragma once
 
+#include <algorithm>
+#include <cmath>
+#include <limits>
+#include <type_traits>
+
 #include "rapidcheck/detail/BitStream.h"
+#include "rapidcheck/detail/BoundedRandom.h"
 #include "rapidcheck/shrinkable/Create.h"
 #include "rapidcheck/shrink/Shrink.h"
 #include "rapidcheck/gen/Transform.h"
@@ -35,6 +41,143 @@ extern template Shrinkable<long long> integral<long long>(const Random &random,
 extern template Shrinkable<unsigned long long>
 integral<unsigned long long>(const Random &random, int size);
 
+/// The kinds of values that `realWithOptions` can generate.
+enum class RealKind { Normal, Denormal, Extreme, Infinity, NaN };
+
+/// Picks the kind of value to generate given a uniform `x` in `[0, 1)`. The
+/// rates of special values scale with `size` up to `kNominalSize`.
+inline RealKind realKindFor(const RealOptions &options, double x, int size) {
+  const double scale =
+      std::min(size, kNominalSize) / static_cast<double>(kNominalSize);
+  const RealKind kinds[] = {RealKind::NaN,
+                            RealKind::Infinity,
+                            RealKind::Denormal,
+                            RealKind::Extreme};
+  const double rates[] = {options.nanRate,
+                          options.infinityRate,
+                          options.denormalRate,
+                          options.extremeRate};
+  constexpr auto numKinds = std::extent<decltype(kinds)>::value;
+  static_assert(numKinds == std::extent<decltype(rates)>::value,
+                "Every kind must have a rate");
+  double total = 0.0;
+  for (std::size_t i = 0; i < numKinds; i++) {
+    total += rates[i] * scale;
+    if (x < total) {
+      return kinds[i];
+    }
+  }
+
+  return RealKind::Normal;
+}
+
+/// Returns a value in `[0, 1)` made from the top `numBits` bits of random data.
+template <typename T>
+T randomFraction(Random &random, int numBits) {
+  T fraction(0.0);
+  int consumed = 0;
+  while (consumed < numBits) {
+    const auto chunkBits = std::min(numBits - consumed, 32);
+    const auto chunk = random.next() >> (64 - chunkBits);
+    consumed += chunkBits;
+    fraction += std::ldexp(static_cast<T>(chunk), -consumed);
+  }
+  return fraction;
+}
+
+template <typename T>
+T extremeReal(Random &random) {
+  using Limits = std::numeric_limits<T>;
+  switch (rc::detail::nextBounded(random, 5)) {
+  case 0:
+    return Limits::max();
+  case 1:
+    return Limits::min();
+  case 2:
+    return Limits::denorm_min();
+  case 3:
+    return Limits::epsilon();
+  default:
+    // Somewhere in the top binade, i.e. [max() / 2, max()]
+    return std::ldexp(
+        T(1.0) + randomFraction<T>(random, Limits::digits - 1),
+        Limits::max_exponent - 1);
+  }
+}
+
+template <typename T>
+T normalReal(Random &random, int size) {
+  using Limits = std::numeric_limits<T>;
+  // The exponent is uniform over a range which grows with size so that tiny
+  // values are as likely as huge ones at full size.
+  const auto maxExponent =
+      static_cast<int>(scaleInteger(Limits::max_exponent - 1, size));
+  const auto minExponent =
+      -static_cast<int>(scaleInteger(1 - Limits::min_exponent, size));
+  const auto exponent =
+      minExponent +
+      static_cast<int>(rc::detail::nextBounded(
+          random, static_cast<Random::Number>(maxExponent - minExponent + 1)));
+
+  // Sometimes use only a few mantissa bits to get values like 0.75 or 1024
+  auto mantissaBits = Limits::digits - 1;
+  if (rc::detail::nextBounded(random, 4) == 0) {
+    mantissaBits = static_cast<int>(rc::detail::nextBounded(
+        random, static_cast<Random::Number>(mantissaBits + 1)));
+  }
+
+  return std::ldexp(T(1.0) + randomFraction<T>(random, mantissaBits),
+                    exponent);
+}
+
+template <typename T>
+Shrinkable<T> realWithOptions(const Random &random,
+                              int size,
+                              const RealOptions &options) {
+  using Limits = std::numeric_limits<T>;
+  if (size <= 0) {
+    return shrinkable::just(T(0.0));
+  }
+
+  Random r(random);
+  const double x =
+      static_cast<double>(r.next() >> 11) * (1.0 / 9007199254740992.0);
+  const bool negative = (r.next() & 1) != 0;
+
+  T value;
+  switch (realKindFor(options, x, size)) {
+  case RealKind::NaN:
+    value = Limits::has_quiet_NaN ? Limits::quiet_NaN() : T(0.0);
+    break;
+
+  case RealKind::Infinity:
+    value = Limits::has_infinity ? Limits::infinity() : Limits::max();
+    break;
+
+  case RealKind::Denormal:
+    // Denormals are multiples of denorm_min() below min()
+    value = Limits::min() * randomFraction<T>(r, Limits::digits - 1);
+    if ((value == T(0.0)) || (value >= Limits::min())) {
+      value = Limits::denorm_min();
+    }
+    break;
+
+  case RealKind::Extreme:
+    value = extremeReal<T>(r);
+    break;
+
+  default:
+    value = normalReal<T>(r, size);
+    break;
+  }
+
+  if (negative && !std::isnan(value)) {
+    value = -value;
+  }
+
+  return shrinkable::shrinkRecur(value, &shrink::real<T>);
+}
+
 template <typename T>
 Shrinkable<T> real(const Random &random, int size) {
   // TODO this implementation sucks
@@ -102,13 +245,39 @@ Gen<T> inRange(T min, T max) {
                                  static_cast<Random::Number>(min) - 1,
                              size) +
         1;
-    const auto value =
-        static_cast<T>((Random(random).next() % rangeSize) + min);
+    const auto value = static_cast<T>(
+        rc::detail::nextBounded(Random(random), rangeSize) + min);
     assert(value >= min && value < max);
     return shrinkable::shrinkRecur(
         value, [=](T x) { return shrink::towards<T>(x, min); });
   };
 }
 
+template <typename T>
+Gen<T> real(const RealOptions &options) {
+  static_assert(std::is_floating_point<T>::value,
+                "gen::real requires a floating point type");
+  return [=](const Random &random, int size) {
+    const double rates[] = {options.nanRate,
+                            options.infinityRate,
+                            options.denormalRate,
+                            options.extremeRate};
+    double total = 0.0;
+    for (const auto rate : rates) {
+      if (!(rate >= 0.0 && rate <= 1.0)) {
+        throw GenerationFailure("Rate " + std::to_string(rate) +
+                                " is not in range [0, 1]");
+      }
+      total += rate;
+    }
+    if (total > 1.0) {
+      throw GenerationFailure("Rates add up to " + std::to_string(total) +
+                              " which is more than 1");
+    }
+
+    return detail::realWithOptions<T>(random, size, options);
+  };
+}
+
 } // namespace gen
 } // namespace rc
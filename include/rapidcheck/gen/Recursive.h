@@ -0,0 +1,25 @@
+#pragma once
+
+#include "rapidcheck/Gen.h"
+
+namespace rc {
+namespace gen {
+
+/// Generates recursive structures such as trees or ASTs. The size is treated as
+/// a budget of inner nodes which is split randomly among the children of each
+/// inner node so the number of inner nodes never exceeds the size, regardless
+/// of how many children each node has. When the budget runs out, `leaf` is
+/// used. When shrinking, inner nodes are first replaced by their children,
+/// then the children are shrunk and lastly the node itself is shrunk.
+///
+/// @param leaf   Generator of leaves.
+/// @param arity  Generator of the number of children of an inner node.
+/// @param node   Callable which, given a `std::vector<T>` of children, returns
+///               a `Gen<T>` of inner nodes with those children.
+template <typename T, typename Node>
+Gen<T> recursive(Gen<T> leaf, Gen<std::size_t> arity, Node &&node);
+
+} // namespace gen
+} // namespace rc
+
+#include "Recursive.hpp"
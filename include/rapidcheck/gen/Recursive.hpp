@@ -0,0 +1,119 @@
+#pragma once
+
+#include <algorithm>
+
+#include "rapidcheck/detail/BoundedRandom.h"
+#include "rapidcheck/gen/detail/ShrinkValueIterator.h"
+#include "rapidcheck/shrink/Shrink.h"
+#include "rapidcheck/shrinkable/Create.h"
+#include "rapidcheck/shrinkable/Transform.h"
+
+namespace rc {
+namespace gen {
+namespace detail {
+
+template <typename T, typename Node>
+class RecursiveGen {
+public:
+  template <typename NodeArg>
+  RecursiveGen(Gen<T> leaf, Gen<std::size_t> arity, NodeArg &&node)
+      : m_leaf(std::move(leaf))
+      , m_arity(std::move(arity))
+      , m_node(std::forward<NodeArg>(node)) {}
+
+  Shrinkable<T> operator()(const Random &random, int size) const {
+    auto r = random;
+    const auto budget = static_cast<std::size_t>(
+        rc::detail::nextBounded(r.split(), std::max(size, 0) + 1));
+    return generateTree(r, size, budget);
+  }
+
+private:
+  using Shrinkables = std::vector<Shrinkable<T>>;
+
+  /// Splits `budget` into `n` random parts that add up to `budget`.
+  static std::vector<std::size_t>
+  splitBudget(Random &random, std::size_t budget, std::size_t n) {
+    std::vector<std::size_t> cuts;
+    cuts.reserve(n + 1);
+    cuts.push_back(0);
+    for (std::size_t i = 1; i < n; i++) {
+      cuts.push_back(
+          static_cast<std::size_t>(rc::detail::nextBounded(random, budget + 1)));
+    }
+    cuts.push_back(budget);
+    std::sort(begin(cuts), end(cuts));
+
+    std::vector<std::size_t> parts;
+    parts.reserve(n);
+    for (std::size_t i = 0; i < n; i++) {
+      parts.push_back(cuts[i + 1] - cuts[i]);
+    }
+    return parts;
+  }
+
+  Shrinkable<T>
+  generateTree(const Random &random, int size, std::size_t budget) const {
+    if (budget == 0) {
+      return m_leaf(random, size);
+    }
+
+    auto r = random;
+    const auto numChildren = m_arity(r.split(), size).value();
+    auto rBudget = r.split();
+    const auto rNode = r.split();
+    // This node uses one unit of the budget, the rest goes to the children
+    const auto budgets = splitBudget(rBudget, budget - 1, numChildren);
+
+    Shrinkables children;
+    children.reserve(numChildren);
+    for (const auto childBudget : budgets) {
+      children.push_back(generateTree(r.split(), size, childBudget));
+    }
+
+    const auto childrenShrinkable = shrinkable::map(
+        shrinkable::shrinkRecur(children,
+                                [](const Shrinkables &elements) {
+                                  return shrink::eachElement(
+                                      elements, [](const Shrinkable<T> &s) {
+                                        return s.shrinks();
+                                      });
+                                }),
+        [](const Shrinkables &elements) {
+          return std::vector<T>(makeShrinkValueIterator(begin(elements)),
+                                makeShrinkValueIterator(end(elements)));
+        });
+
+    const auto node = m_node;
+    const auto nodeShrinkable = shrinkable::mapcat(
+        childrenShrinkable, [=](std::vector<T> &&values) {
+          // Called through a copy so that mutable callables work too
+          auto makeNode = node;
+          return makeNode(std::move(values))(rNode, size);
+        });
+
+    return shrinkable::lambda(
+        [=] { return nodeShrinkable.value(); },
+        [=] {
+          // Promoting a child to take the place of this node is the most
+          // effective shrink so try that first
+          return seq::concat(seq::fromContainer(children),
+                             nodeShrinkable.shrinks());
+        });
+  }
+
+  Gen<T> m_leaf;
+  Gen<std::size_t> m_arity;
+  Node m_node;
+};
+
+} // namespace detail
+
+template <typename T, typename Node>
+Gen<T> recursive(Gen<T> leaf, Gen<std::size_t> arity, Node &&node) {
+  return detail::RecursiveGen<T, Decay<Node>>(
+      std::move(leaf), std::move(arity), std::forward<Node>(node));
+}
+
+} // namespace gen
+} // namespace rc
@@ -1,5 +1,7 @@
 #pragma once
 
+#include "rapidcheck/detail/AliasTable.h"
+#include "rapidcheck/detail/BoundedRandom.h"
 #include "rapidcheck/detail/FrequencyMap.h"
 #include "rapidcheck/gen/detail/ScaleInteger.h"
 
@@ -53,8 +55,8 @@ public:
     if (containerSize == 0) {
       throw GenerationFailure("Cannot pick element from empty container.");
     }
-    const auto i =
-        static_cast<std::size_t>(Random(random).next() % containerSize);
+    const auto i = static_cast<std::size_t>(
+        rc::detail::nextBounded(Random(random), containerSize));
     return shrinkable::just(*(start + i));
   }
 
@@ -62,24 +64,43 @@ private:
   Container m_container;
 };
 
+/// Weight tables with at least this many entries use an `AliasTable` instead
+/// of a `FrequencyMap`.
+constexpr std::size_t kMinAliasTableSize = 64;
+
 template <typename T>
 class WeightedElementGen {
 public:
   WeightedElementGen(std::vector<std::size_t> &&frequencies,
                      std::vector<T> &&elements)
-      : m_map(std::move(frequencies))
+      : m_useAliasTable(frequencies.size() >= kMinAliasTableSize)
+      // Both operands are lvalues so the chosen one is not copied
+      , m_map(m_useAliasTable ? noFrequencies() : frequencies)
+      , m_aliasTable(m_useAliasTable ? frequencies : noFrequencies())
       , m_elements(std::move(elements)) {}
 
   Shrinkable<T> operator()(const Random &random, int /*size*/) const {
-    if (m_map.sum() == 0) {
+    const auto sum = m_useAliasTable ? m_aliasTable.sum() : m_map.sum();
+    if (sum == 0) {
       throw GenerationFailure("Sum of weights is 0");
     }
-    return shrinkable::just(static_cast<T>(
-        m_elements[m_map.lookup(Random(random).next() % m_map.sum())]));
+
+    Random r(random);
+    const auto i = m_useAliasTable
+        ? m_aliasTable.lookup(r.next())
+        : m_map.lookup(rc::detail::nextBounded(r, sum));
+    return shrinkable::just(static_cast<T>(m_elements[i]));
   }
 
 private:
+  static const std::vector<std::size_t> &noFrequencies() {
+    static const std::vector<std::size_t> frequencies;
+    return frequencies;
+  }
+
+  bool m_useAliasTable;
   rc::detail::FrequencyMap m_map;
+  rc::detail::AliasTable m_aliasTable;
   std::vector<T> m_elements;
 };
 
@@ -101,7 +122,8 @@ public:
     const auto container = m_container;
     return shrinkable::map(
         shrinkable::shrinkRecur(
-            static_cast<std::size_t>(Random(random).next() % max),
+            static_cast<std::size_t>(
+                rc::detail::nextBounded(Random(random), max)),
             [](std::size_t x) { return shrink::towards<std::size_t>(x, 0); }),
         [=](std::size_t x) { return container[x]; });
   }
@@ -119,7 +141,8 @@ public:
 
   Shrinkable<T> operator()(const Random &random, int size) const {
     Random r(random);
-    const auto i = static_cast<std::size_t>(r.split().next() % m_gens.size());
+    const auto i = static_cast<std::size_t>(
+        rc::detail::nextBounded(r.split(), m_gens.size()));
     return m_gens[i](r, size);
   }
 
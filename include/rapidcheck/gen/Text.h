@@ -1,5 +1,9 @@
 #pragma once
 
+#include <string>
+#include <utility>
+#include <vector>
+
 #include "rapidcheck/Gen.h"
 
 namespace rc {
@@ -17,6 +21,67 @@ Gen<T> character();
 template <typename String>
 Gen<String> string();
 
+/// A set of Unicode code points to generate text from. The code points are
+/// ordered and the ones that come first are considered simpler when
+/// shrinking. Surrogates and values above `0x10FFFF` are never included.
+class Charset {
+public:
+  /// An inclusive range of code points.
+  using Range = std::pair<char32_t, char32_t>;
+
+  /// Creates a charset from the given ranges where code points in earlier
+  /// ranges are simpler. Ranges where `first > second` are empty.
+  explicit Charset(const std::vector<Range> &ranges);
+
+  /// Creates a charset of exactly the given characters, simplest first.
+  /// Repeated characters are only included once.
+  static Charset of(const std::u32string &chars);
+
+  /// Printable ASCII, i.e. letters, digits, punctuation and space.
+  static Charset asciiPrintable();
+
+  /// All code points of the given Unicode plane, `0` being the Basic
+  /// Multilingual Plane. Control characters are not included.
+  static Charset plane(unsigned int n);
+
+  /// All Unicode scalar values except control characters, with printable ASCII
+  /// first.
+  static Charset unicode();
+
+  /// Returns the number of code points in this charset.
+  std::size_t size() const { return m_size; }
+
+  /// Returns the code point at the given index.
+  char32_t operator[](std::size_t i) const;
+
+private:
+  void addRange(char32_t first, char32_t last);
+
+  std::vector<Range> m_ranges;
+  /// The index of the first code point of each range.
+  std::vector<std::size_t> m_offsets;
+  /// All code points when there are few enough for a flat lookup table.
+  std::u32string m_table;
+  std::size_t m_size;
+};
+
+/// Generates strings of code points from the given charset. The string is
+/// encoded as UTF-8, UTF-16 or UTF-32 depending on the size of the character
+/// type of `String`. When shrinking, characters are removed and shrink towards
+/// the simplest code points of the charset.
+template <typename String>
+Gen<String> string(Charset charset);
+
+/// Generates strings that match the given regular expression. The expression
+/// is compiled once into flat tables and each string is described by a compact
+/// sequence of choices which is what gets shrunk, so shrinks always match the
+/// expression as well. Supports literals, `.`, character classes (including
+/// ranges, negation and `\d`, `\w`, `\s` and their negations), groups,
+/// alternation and the quantifiers `*`, `+`, `?`, `{n}`, `{n,}` and `{n,m}`.
+/// Unbounded repetitions grow with size. If the expression is invalid,
+/// generation fails.
+Gen<std::string> regex(const std::string &pattern);
+
 } // namespace gen
 } // namespace rc
 
@@ -1,8 +1,11 @@
 #pragma once
 
+#include <algorithm>
 #include <cctype>
+#include <memory>
 
 #include "rapidcheck/detail/BitStream.h"
+#include "rapidcheck/detail/BoundedRandom.h"
 #include "rapidcheck/gen/Container.h"
 
 namespace rc {
@@ -32,13 +35,84 @@ public:
       str.push_back(value);
     }
 
-    return shrinkable::shrinkRecur(
-        std::move(str),
-        [](const String &s) {
-          return seq::concat(shrink::removeChunks(s),
-                             shrink::eachElement(s, &shrink::character<T>));
+    return shrinkable::shrinkContainer(std::move(str), &shrink::character<T>);
+  }
+};
+
+/// Appends `c` to `str` encoded as UTF-8, UTF-16 or UTF-32 depending on the
+/// size of `T`.
+template <typename T, typename... Args>
+void appendCodePoint(std::basic_string<T, Args...> &str, char32_t c) {
+  if (sizeof(T) >= 4) {
+    str.push_back(static_cast<T>(c));
+  } else if (sizeof(T) == 2) {
+    if (c < 0x10000) {
+      str.push_back(static_cast<T>(c));
+    } else {
+      const auto x = c - 0x10000;
+      str.push_back(static_cast<T>(0xD800 + (x >> 10)));
+      str.push_back(static_cast<T>(0xDC00 + (x & 0x3FF)));
+    }
+  } else if (c < 0x80) {
+    str.push_back(static_cast<T>(c));
+  } else if (c < 0x800) {
+    str.push_back(static_cast<T>(0xC0 | (c >> 6)));
+    str.push_back(static_cast<T>(0x80 | (c & 0x3F)));
+  } else if (c < 0x10000) {
+    str.push_back(static_cast<T>(0xE0 | (c >> 12)));
+    str.push_back(static_cast<T>(0x80 | ((c >> 6) & 0x3F)));
+    str.push_back(static_cast<T>(0x80 | (c & 0x3F)));
+  } else {
+    str.push_back(static_cast<T>(0xF0 | (c >> 18)));
+    str.push_back(static_cast<T>(0x80 | ((c >> 12) & 0x3F)));
+    str.push_back(static_cast<T>(0x80 | ((c >> 6) & 0x3F)));
+    str.push_back(static_cast<T>(0x80 | (c & 0x3F)));
+  }
+}
+
+template <typename String>
+class CharsetStringGen {
+public:
+  explicit CharsetStringGen(Charset charset)
+      : m_charset(std::make_shared<const Charset>(std::move(charset))) {}
+
+  Shrinkable<String> operator()(const Random &random, int size) const {
+    // Characters are generated as indexes into the charset and only encoded
+    // when needed so that shrinking works on code points
+    using Indexes = std::vector<std::uint32_t>;
+    Random r(random);
+    const auto length = static_cast<std::size_t>(
+        rc::detail::nextBounded(
+            r, static_cast<std::uint64_t>(std::max(size, 0)) + 1));
+    const auto charset = m_charset;
+    if ((length > 0) && (charset->size() == 0)) {
+      throw GenerationFailure("Cannot generate characters from empty charset");
+    }
+
+    Indexes indexes(length);
+    for (auto &index : indexes) {
+      index = static_cast<std::uint32_t>(
+          rc::detail::nextBounded(r, charset->size()));
+    }
+
+    return shrinkable::map(
+        shrinkable::shrinkContainer(std::move(indexes),
+                                    [](std::uint32_t x) {
+                                      return shrink::towards<std::uint32_t>(x,
+                                                                            0);
+                                    }),
+        [=](const Indexes &s) {
+          String str;
+          str.reserve(s.size());
+          for (const auto index : s) {
+            appendCodePoint(str, (*charset)[index]);
+          }
+          return str;
         });
   }
+
+private:
+  std::shared_ptr<const Charset> m_charset;
 };
 
 template <typename T, typename... Args>
@@ -69,6 +143,11 @@ Gen<String> string() {
   return detail::StringGen<String>();
 }
 
+template <typename String>
+Gen<String> string(Charset charset) {
+  return detail::CharsetStringGen<String>(std::move(charset));
+}
+
 } // namespace gen
 } // namespace rc
 
@@ -1,5 +1,7 @@
 #pragma once
 
+#include <memory>
+
 #include "rapidcheck/shrinkable/Create.h"
 #include "rapidcheck/gen/Arbitrary.h"
 #include "rapidcheck/gen/Transform.h"
@@ -9,25 +11,33 @@ namespace rc {
 namespace gen {
 namespace detail {
 
+// Tuples are shrunk one component at a time. To make this cheap for tuples
+// with many components, the component shrinkables are kept in a shared,
+// immutable tuple and each shrink only holds the single component that
+// changed. The full tuple of shrinkables is only copied when the shrinks of a
+// shrink are requested, i.e. when shrinking proceeds from it.
+
+template <typename... Ts>
+using TupleShrinkables = std::shared_ptr<const std::tuple<Shrinkable<Ts>...>>;
+
 template <typename Indexes, typename... Ts>
 class TupleShrinkable;
 
+template <std::size_t I, typename Indexes, typename... Ts>
+class TupleComponentShrinkable;
+
 template <typename Indexes, typename... Ts>
 class TupleGen;
 
 template <std::size_t I, typename Indexes, typename... Ts>
-class TupleShrinkSeq;
-
-template <std::size_t I, typename... Ts, std::size_t... Indexes>
-class TupleShrinkSeq<I, rc::detail::IndexSequence<Indexes...>, Ts...> {
+class TupleShrinkSeq {
 public:
   using Tuple = std::tuple<Ts...>;
   using T = typename std::tuple_element<I, Tuple>::type;
 
-  template <typename... Args>
-  explicit TupleShrinkSeq(Args &&... args)
-      : m_original(std::forward<Args>(args)...)
-      , m_shrinks(std::get<I>(m_original).shrinks()) {}
+  explicit TupleShrinkSeq(TupleShrinkables<Ts...> shrinkables)
+      : m_shrinkables(std::move(shrinkables))
+      , m_shrinks(std::get<I>(*m_shrinkables).shrinks()) {}
 
   Maybe<Shrinkable<Tuple>> operator()() {
     auto value = m_shrinks.next();
@@ -36,51 +46,77 @@ public:
       return Nothing;
     }
 
-    auto shrink = m_original;
-    std::get<I>(shrink) = std::move(*value);
-    using IndexSeq = rc::detail::MakeIndexSequence<sizeof...(Ts)>;
-    using ShrinkableImpl = TupleShrinkable<IndexSeq, Ts...>;
-    auto shrinkable =
-        makeShrinkable<ShrinkableImpl>(std::move(std::get<Indexes>(shrink))...);
-    return shrinkable;
+    using ShrinkableImpl = TupleComponentShrinkable<I, Indexes, Ts...>;
+    return makeShrinkable<ShrinkableImpl>(m_shrinkables, std::move(*value));
   }
 
 private:
-  std::tuple<Shrinkable<Ts>...> m_original;
+  TupleShrinkables<Ts...> m_shrinkables;
   Seq<Shrinkable<T>> m_shrinks;
 };
 
 template <typename... Ts, std::size_t... Indexes>
 class TupleShrinkable<rc::detail::IndexSequence<Indexes...>, Ts...> {
 public:
-  template <typename... Args>
-  explicit TupleShrinkable(Args &&... args)
-      : m_shrinkables(std::forward<Args>(args)...) {}
+  explicit TupleShrinkable(TupleShrinkables<Ts...> shrinkables)
+      : m_shrinkables(std::move(shrinkables)) {}
 
   std::tuple<Ts...> value() const {
-    return std::make_tuple(std::get<Indexes>(m_shrinkables).value()...);
+    return std::make_tuple(std::get<Indexes>(*m_shrinkables).value()...);
   }
 
   Seq<Shrinkable<std::tuple<Ts...>>> shrinks() const {
     using IndexSeq = rc::detail::IndexSequence<Indexes...>;
-    return seq::concat(makeSeq<TupleShrinkSeq<Indexes, IndexSeq, Ts...>>(
-        std::get<Indexes>(m_shrinkables)...)...);
+    return seq::concat(
+        makeSeq<TupleShrinkSeq<Indexes, IndexSeq, Ts...>>(m_shrinkables)...);
   }
 
 private:
+  TupleShrinkables<Ts...> m_shrinkables;
+};
+
+/// A shrink of a tuple where only component `I` differs from the shared
+/// shrinkables.
+template <std::size_t I, typename... Ts, std::size_t... Indexes>
+class TupleComponentShrinkable<I, rc::detail::IndexSequence<Indexes...>, Ts...> {
+public:
+  using Tuple = std::tuple<Ts...>;
+  using T = typename std::tuple_element<I, Tuple>::type;
+
+  TupleComponentShrinkable(TupleShrinkables<Ts...> shrinkables,
+                           Shrinkable<T> component)
+      : m_shrinkables(std::move(shrinkables))
+      , m_component(std::move(component)) {}
+
+  Tuple value() const {
+    return std::make_tuple(componentValue<Indexes>(
+        std::integral_constant<bool, Indexes == I>())...);
+  }
+
+  Seq<Shrinkable<Tuple>> shrinks() const {
+    auto shrinkables = *m_shrinkables;
+    std::get<I>(shrinkables) = m_component;
+    using IndexSeq = rc::detail::IndexSequence<Indexes...>;
+    return TupleShrinkable<IndexSeq, Ts...>(
+               std::make_shared<const std::tuple<Shrinkable<Ts>...>>(
+                   std::move(shrinkables)))
+        .shrinks();
+  }
+
+private:
+  template <std::size_t N>
+  typename std::tuple_element<N, Tuple>::type
+  componentValue(std::false_type) const {
+    return std::get<N>(*m_shrinkables).value();
+  }
+
   template <std::size_t N>
-  static Seq<std::tuple<Shrinkable<Ts>...>>
-  shrinkComponent(const std::tuple<Shrinkable<Ts>...> &tuple) {
-    using T = typename std::tuple_element<N, std::tuple<Ts...>>::type;
-    return seq::map(std::get<N>(tuple).shrinks(),
-                    [=](Shrinkable<T> &&cshrink) {
-                      auto shrink(tuple);
-                      std::get<N>(shrink) = cshrink;
-                      return shrink;
-                    });
+  T componentValue(std::true_type) const {
+    return m_component.value();
   }
 
-  std::tuple<Shrinkable<Ts>...> m_shrinkables;
+  TupleShrinkables<Ts...> m_shrinkables;
+  Shrinkable<T> m_component;
 };
 
 template <typename... Ts, std::size_t... Indexes>
@@ -101,7 +137,8 @@ public:
     using ShrinkableImpl =
         TupleShrinkable<rc::detail::IndexSequence<Indexes...>, Ts...>;
     return makeShrinkable<ShrinkableImpl>(
-        std::get<Indexes>(m_gens)(randoms[Indexes], size)...);
+        std::make_shared<const std::tuple<Shrinkable<Ts>...>>(
+            std::get<Indexes>(m_gens)(randoms[Indexes], size)...));
   }
 
 private:
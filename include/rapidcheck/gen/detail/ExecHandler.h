@@ -1,5 +1,7 @@
 #pragma once
 
+#include <functional>
+
 #include "rapidcheck/gen/detail/GenerationHandler.h"
 #include "rapidcheck/gen/detail/Recipe.h"
 
@@ -10,14 +12,21 @@ namespace detail {
 /// `GenerationHandler` used to implement `execRaw`.
 class ExecHandler : public GenerationHandler {
 public:
+  /// Called with every ingredient that is added to the recipe. Must not throw.
+  using IngredientObserver = std::function<void(const Recipe::Ingredient &)>;
+
   ExecHandler(Recipe &recipe);
+  void onGenerateValue(GenerationRequest &request) override;
   rc::detail::Any onGenerate(const Gen<rc::detail::Any> &gen) override;
 
 private:
+  using Iterator = Recipe::Ingredients::iterator;
+  void onIngredientAdded(Iterator it);
+
   Recipe &m_recipe;
   Random m_random;
-  using Iterator = Recipe::Ingredients::iterator;
   Iterator m_it;
+  IngredientObserver m_observer;
 };
 
 } // namespace detail
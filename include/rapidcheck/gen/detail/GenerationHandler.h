@@ -1,10 +1,21 @@
 #pragma once
 
+#include <memory>
+#include <string>
+
 namespace rc {
 
 template <typename T>
 class Gen;
 
+template <typename T>
+class Shrinkable;
+
+template <typename T>
+class Maybe;
+
+class Random;
+
 namespace detail {
 
 class Any;
@@ -14,11 +25,54 @@ class Any;
 namespace gen {
 namespace detail {
 
+/// A request for a value from a dereferenced `Gen<T>`. Refers to the generator
+/// and to the storage for the resulting value without owning either so that no
+/// type erased copy of the generator needs to be allocated.
+class GenerationRequest {
+public:
+  template <typename T>
+  GenerationRequest(const Gen<T> &gen, Maybe<T> &result);
+
+  /// Returns the name of the generator or `nullptr` if it has none.
+  const std::shared_ptr<const std::string> &name() const { return *m_name; }
+
+  /// Generates a shrinkable using the generator and sets the result to its
+  /// value without boxing it in an `Any`.
+  ///
+  /// @return The generated shrinkable, erased to `Any`.
+  Shrinkable<rc::detail::Any> generate(const Random &random, int size);
+
+  /// Sets the result to the value contained in the given `Any` which must
+  /// (obviously) have the same type as the generator.
+  void setValue(rc::detail::Any &&value);
+
+  /// Returns a copy of the generator, erased to `Any`.
+  Gen<rc::detail::Any> erased() const;
+
+private:
+  const void *m_gen;
+  void *m_result;
+  const std::shared_ptr<const std::string> *m_name;
+  Shrinkable<rc::detail::Any> (*m_generate)(const void *gen,
+                                             void *result,
+                                             const Random &random,
+                                             int size);
+  void (*m_setValue)(void *result, rc::detail::Any &&value);
+  Gen<rc::detail::Any> (*m_erased)(
+      const void *gen, const std::shared_ptr<const std::string> &name);
+};
+
 /// Implementations of this class receive callbacks when `operator*` of `Gen` is
 /// invoked.
 class GenerationHandler {
 public:
-  /// Invoked in response to a call to `operator*` in `Gen`.
+  /// Invoked in response to a call to `operator*` in `Gen`. Implementations
+  /// must set the result of `request`, either by calling `generate` or
+  /// `setValue`. The default implementation calls `onGenerate` with the erased
+  /// generator. Overriding this avoids the allocations associated with that.
+  virtual void onGenerateValue(GenerationRequest &request);
+
+  /// Invoked by the default implementation of `onGenerateValue`.
   ///
   /// @param gen  A type erased version (erased to `Any`) of the generator
   ///             that was dereferenced.
@@ -1,5 +1,7 @@
 #pragma once
 
+#include <memory>
+#include <string>
 #include <vector>
 
 #include "rapidcheck/Shrinkable.h"
@@ -16,12 +18,17 @@ namespace detail {
 /// `Random` generator to use and the size.
 struct Recipe {
   struct Ingredient {
-    Ingredient(std::string &&d, Shrinkable<rc::detail::Any> &&s)
+    Ingredient(std::shared_ptr<const std::string> d,
+               Shrinkable<rc::detail::Any> &&s)
         : description(std::move(d))
         , shrinkable(std::move(s)) {}
 
-    /// A description of the shrinkable value.
-    std::string description;
+    Ingredient(const std::string &d, Shrinkable<rc::detail::Any> &&s)
+        : Ingredient(std::make_shared<const std::string>(d), std::move(s)) {}
+
+    /// A description of the shrinkable value, shared with the generator, or
+    /// `nullptr` if there is none.
+    std::shared_ptr<const std::string> description;
 
     // The shrinkable value itself.
     Shrinkable<rc::detail::Any> shrinkable;
@@ -28,6 +28,18 @@ Seq<Container> removeChunks(Container elements);
 template <typename Container, typename Shrink>
 Seq<Container> eachElement(Container elements, Shrink shrink);
 
+/// Shrinks the given container towards its sorted order. The entire container
+/// sorted is tried first followed by sorting successively smaller chunks and
+/// finally swapping pairs of elements that are out of order. Every shrink has fewer
+/// inversions (pairs of elements in the wrong order) than the original so
+/// repeated shrinking always terminates.
+///
+/// `Container` must support `begin(Container)` and `end(Container)` which must
+/// return random access iterators and the elements must be comparable using
+/// `operator<`.
+template <typename Container>
+Seq<Container> towardsSorted(Container elements);
+
 /// Shrinks an integral value towards another integral value.
 ///
 /// @param value   The value to shrink.
@@ -1,6 +1,8 @@
 #pragma once
 
+#include <algorithm>
 #include <cmath>
+#include <limits>
 #include <locale>
 
 #include "rapidcheck/seq/Transform.h"
@@ -118,6 +120,63 @@ private:
   std::size_t m_i;
 };
 
+template <typename Container>
+class TowardsSortedSeq {
+public:
+  template <typename ContainerArg>
+  explicit TowardsSortedSeq(ContainerArg &&elements)
+      : m_elements(std::forward<ContainerArg>(elements))
+      , m_chunkSize(m_elements.size())
+      , m_start(0)
+      , m_other(1) {}
+
+  Maybe<Container> operator()() {
+    const auto size = m_elements.size();
+    // First sort chunks, halving the chunk size each round. Chunks of two are
+    // covered by the swaps below.
+    while (m_chunkSize > 2) {
+      const auto start = m_start;
+      const auto fin = std::min(start + m_chunkSize, size);
+      m_start = fin;
+      if (m_start >= size) {
+        m_chunkSize /= 2;
+        m_start = 0;
+      }
+
+      const auto first = begin(m_elements) + start;
+      const auto last = begin(m_elements) + fin;
+      if (!std::is_sorted(first, last)) {
+        auto elements = m_elements;
+        std::sort(begin(elements) + start, begin(elements) + fin);
+        return elements;
+      }
+    }
+
+    // Then swap pairs of elements that are out of order
+    while ((m_start + 1) < size) {
+      const auto i = m_start;
+      const auto j = m_other++;
+      if (m_other >= size) {
+        m_start++;
+        m_other = m_start + 1;
+      }
+      if (m_elements[j] < m_elements[i]) {
+        auto elements = m_elements;
+        std::swap(elements[i], elements[j]);
+        return elements;
+      }
+    }
+
+    return Nothing;
+  }
+
+private:
+  Container m_elements;
+  std::size_t m_chunkSize;
+  std::size_t m_start;
+  std::size_t m_other;
+};
+
 template <typename T>
 Seq<T> integral(T value, std::true_type) {
   // The check for > min() is important since -min() == min() and we never
@@ -150,6 +209,11 @@ Seq<Container> eachElement(Container elements, Shrink shrink) {
                                                             std::move(shrink));
 }
 
+template <typename Container>
+Seq<Container> towardsSorted(Container elements) {
+  return makeSeq<detail::TowardsSortedSeq<Container>>(std::move(elements));
+}
+
 template <typename T>
 Seq<T> towards(T value, T target) {
   return makeSeq<detail::TowardsSeq<T>>(value, target);
@@ -163,11 +227,35 @@ Seq<T> integral(T value) {
 template <typename T, typename>
 Seq<T> integral(T value);
 
+namespace detail {
+
+/// Returns the smallest number of decimals that `value` can be rounded to
+/// without changing it or `-1` if there is no such number.
+template <typename T>
+int decimalPlaces(T value) {
+  T scale(1.0);
+  for (int d = 0; d <= std::numeric_limits<T>::max_digits10; d++) {
+    const auto scaled = value * scale;
+    if (!std::isfinite(scaled)) {
+      break;
+    }
+    if ((std::round(scaled) / scale) == value) {
+      return d;
+    }
+    scale *= T(10.0);
+  }
+
+  return -1;
+}
+
+} // namespace detail
+
 template <typename T>
 Seq<T> real(T value) {
   std::vector<T> shrinks;
 
-  if (std::abs(value) > 0) {
+  // Also true for NaN
+  if (!(value == T(0.0))) {
     shrinks.push_back(T(0.0));
   }
 
@@ -175,11 +263,49 @@ Seq<T> real(T value) {
     shrinks.push_back(-value);
   }
 
+  if (!std::isfinite(value)) {
+    return seq::fromContainer(shrinks);
+  }
+
   T truncated = std::trunc(value);
   if (std::abs(truncated) < std::abs(value)) {
     shrinks.push_back(truncated);
   }
 
+  // Try values with fewer decimals, i.e. 3.14159 -> 3.1, 3.14, 3.142...
+  // Every candidate needs strictly fewer decimals so shrinking terminates.
+  const auto places = detail::decimalPlaces(value);
+  const auto maxPlaces =
+      (places == -1) ? std::numeric_limits<T>::max_digits10 : places - 1;
+  T scale(10.0);
+  for (int d = 1; d <= maxPlaces; d++) {
+    const auto rounded = std::round(value * scale) / scale;
+    if (std::isfinite(rounded) && (rounded != truncated) &&
+        (shrinks.empty() || (rounded != shrinks.back()))) {
+      const auto roundedPlaces = detail::decimalPlaces(rounded);
+      if ((roundedPlaces != -1) && (roundedPlaces < d + 1) &&
+          ((places == -1) || (roundedPlaces < places))) {
+        shrinks.push_back(rounded);
+      }
+    }
+    scale *= T(10.0);
+  }
+
+  // Integers shrink towards zero like integral values do
+  if (places == 0) {
+    T diff = std::trunc(value / 2);
+    while (diff != 0) {
+      const T shrink = value - diff;
+      if (shrink == value) {
+        break;
+      }
+      if (shrink != 0) {
+        shrinks.push_back(shrink);
+      }
+      diff = std::trunc(diff / 2);
+    }
+  }
+
   return seq::fromContainer(shrinks);
 }
 
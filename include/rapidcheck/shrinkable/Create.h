@@ -41,6 +41,18 @@ Shrinkable<typename rc::compat::return_type<Value>::type> shrink(Value &&value,
 template <typename T, typename Shrink>
 Shrinkable<Decay<T>> shrinkRecur(T &&value, const Shrink &shrinkf);
 
+/// Creates a `Shrinkable` for a container which shrinks by first removing
+/// chunks of elements and then shrinking each element using `shrinkElement`, a
+/// callable which returns a `Seq` of shrinks when called with an element. This
+/// is equivalent to using `shrinkRecur` with `shrink::removeChunks` followed by
+/// `shrink::eachElement` but each shrink only records the edit that was made
+/// and shares the container it was made to, so the container of a shrink is
+/// only built when its value is requested. The container must support random
+/// access iterators and `reserve`.
+template <typename Container, typename Shrink>
+Shrinkable<Decay<Container>> shrinkContainer(Container &&elements,
+                                             Shrink shrinkElement);
+
 } // namespace shrinkable
 } // namespace rc
 
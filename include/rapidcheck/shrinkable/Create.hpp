@@ -1,5 +1,7 @@
 #pragma once
 
+#include <memory>
+
 #include "rapidcheck/fn/Common.h"
 #include "rapidcheck/seq/Transform.h"
 #include "rapidcheck/Compat.h"
@@ -45,6 +47,120 @@ private:
   Shrink m_shrink;
 };
 
+/// A container described as an edit of a shared parent container, either the
+/// removal of the range `[start, start + size)` or the replacement of the
+/// element at `start`. An edit that removes nothing and replaces nothing is the
+/// parent itself.
+template <typename Container, typename Shrink>
+class ContainerEditShrinkable {
+public:
+  using T = typename Container::value_type;
+
+  ContainerEditShrinkable(std::shared_ptr<const Container> parent,
+                          std::size_t start,
+                          std::size_t size,
+                          Maybe<T> replacement,
+                          Shrink shrink)
+      : m_parent(std::move(parent))
+      , m_start(start)
+      , m_size(size)
+      , m_replacement(std::move(replacement))
+      , m_shrink(std::move(shrink)) {}
+
+  Container value() const {
+    if (m_replacement) {
+      auto elements = *m_parent;
+      elements[m_start] = *m_replacement;
+      return elements;
+    }
+
+    if (m_size == 0) {
+      return *m_parent;
+    }
+
+    Container elements;
+    elements.reserve(m_parent->size() - m_size);
+    const auto start = begin(*m_parent);
+    const auto fin = end(*m_parent);
+    elements.insert(end(elements), start, start + m_start);
+    elements.insert(end(elements), start + m_start + m_size, fin);
+    return elements;
+  }
+
+  Seq<Shrinkable<Container>> shrinks() const;
+
+private:
+  std::shared_ptr<const Container> m_parent;
+  std::size_t m_start;
+  std::size_t m_size;
+  Maybe<T> m_replacement;
+  Shrink m_shrink;
+};
+
+/// Yields the same shrinks as `shrink::removeChunks` followed by
+/// `shrink::eachElement` but as edits of the shared parent.
+template <typename Container, typename Shrink>
+class ContainerEditSeq {
+public:
+  using T = typename Container::value_type;
+  using EditShrinkable = ContainerEditShrinkable<Container, Shrink>;
+
+  ContainerEditSeq(std::shared_ptr<const Container> parent, Shrink shrink)
+      : m_parent(std::move(parent))
+      , m_shrink(std::move(shrink))
+      , m_start(0)
+      , m_size(m_parent->size())
+      , m_i(0) {}
+
+  Maybe<Shrinkable<Container>> operator()() {
+    if (m_size != 0) {
+      auto shrinkable = makeShrinkable<EditShrinkable>(
+          m_parent, m_start, m_size, Nothing, m_shrink);
+      if ((m_size + m_start) >= m_parent->size()) {
+        m_size--;
+        m_start = 0;
+      } else {
+        m_start++;
+      }
+      return shrinkable;
+    }
+
+    while (true) {
+      auto value = m_shrinks.next();
+      if (value) {
+        return makeShrinkable<EditShrinkable>(
+            m_parent, m_i - 1, 0, std::move(value), m_shrink);
+      }
+
+      if (m_i >= m_parent->size()) {
+        return Nothing;
+      }
+
+      m_shrinks = m_shrink((*m_parent)[m_i++]);
+    }
+  }
+
+private:
+  std::shared_ptr<const Container> m_parent;
+  Shrink m_shrink;
+  std::size_t m_start;
+  std::size_t m_size;
+  Seq<T> m_shrinks;
+  std::size_t m_i;
+};
+
+template <typename Container, typename Shrink>
+Seq<Shrinkable<Container>>
+ContainerEditShrinkable<Container, Shrink>::shrinks() const {
+  // The shrinks are edits of the container described by this edit so it
+  // needs to be built, but only once
+  auto parent = (m_replacement || (m_size != 0))
+      ? std::make_shared<const Container>(value())
+      : m_parent;
+  return makeSeq<ContainerEditSeq<Container, Shrink>>(std::move(parent),
+                                                      m_shrink);
+}
+
 } // namespace detail
 
 // TODO test _all_ of these?
@@ -96,5 +212,18 @@ Shrinkable<Decay<T>> shrinkRecur(T &&value, const Shrink &shrinkf) {
                             });
 }
 
+template <typename Container, typename Shrink>
+Shrinkable<Decay<Container>> shrinkContainer(Container &&elements,
+                                             Shrink shrinkElement) {
+  using Impl = detail::ContainerEditShrinkable<Decay<Container>, Shrink>;
+  return makeShrinkable<Impl>(
+      std::make_shared<const Decay<Container>>(
+          std::forward<Container>(elements)),
+      0,
+      0,
+      Nothing,
+      std::move(shrinkElement));
+}
+
 } // namespace shrinkable
 } // namespace rc
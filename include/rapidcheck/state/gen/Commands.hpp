@@ -3,6 +3,7 @@
 #include <algorithm>
 
 #include "rapidcheck/Random.h"
+#include "rapidcheck/detail/BoundedRandom.h"
 #include "rapidcheck/GenerationFailure.h"
 #include "rapidcheck/shrinkable/Transform.h"
 #include "rapidcheck/Compat.h"
@@ -86,7 +87,8 @@ private:
         , m_genFunc(func)
         , m_size(sz) {
       auto r = random;
-      std::size_t count = (r.split().next() % (m_size + 1)) + 1;
+      const auto count = static_cast<std::size_t>(
+          rc::detail::nextBounded(r.split(), m_size + 1) + 1);
       generateInitial(r, count);
     }
 
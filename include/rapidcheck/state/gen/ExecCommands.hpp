@@ -1,5 +1,7 @@
 #pragma once
 
+#include "rapidcheck/detail/BoundedRandom.h"
+
 namespace rc {
 namespace state {
 namespace gen {
@@ -52,7 +54,8 @@ public:
     static const MakeFunc makeFuncs[] = {&MakeCommand<Cmd, ArgsList>::make,
                                          &MakeCommand<Cmds, ArgsList>::make...};
     auto r = random;
-    std::size_t n = r.split().next() % (sizeof...(Cmds) + 1);
+    const auto n = static_cast<std::size_t>(
+        rc::detail::nextBounded(r.split(), sizeof...(Cmds) + 1));
     const auto args = m_args;
     return rc::gen::exec([=] {
       return rc::detail::applyTuple(args, makeFuncs[n]);
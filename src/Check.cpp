@@ -25,6 +25,7 @@ checkProperty(const Property &property,
     auto reproduce = it->second;
     if (params.disableShrinking) {
       reproduce.shrinkPath.clear();
+      reproduce.choices.clear();
     }
     return reproduceProperty(property, reproduce);
   }
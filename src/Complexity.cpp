@@ -0,0 +1,69 @@
+#include "rapidcheck/Complexity.h"
+
+#include <algorithm>
+#include <iostream>
+
+#include "rapidcheck/detail/ImplicitParam.h"
+#include "rapidcheck/detail/PropertyContext.h"
+
+namespace rc {
+
+std::ostream &operator<<(std::ostream &os, Complexity complexity) {
+  switch (complexity) {
+  case Complexity::Constant:
+    os << "O(1)";
+    break;
+  case Complexity::Linear:
+    os << "O(n)";
+    break;
+  case Complexity::Linearithmic:
+    os << "O(n log n)";
+    break;
+  case Complexity::Quadratic:
+    os << "O(n^2)";
+    break;
+  }
+  return os;
+}
+
+namespace detail {
+
+std::ostream &operator<<(std::ostream &os, const ComplexitySample &sample) {
+  os << "{n=" << sample.n << ", seconds=" << sample.seconds;
+  if (sample.bound) {
+    os << ", bound=" << *sample.bound;
+  }
+  os << "}";
+  return os;
+}
+
+bool operator==(const ComplexitySample &lhs, const ComplexitySample &rhs) {
+  return (lhs.n == rhs.n) && (lhs.seconds == rhs.seconds) &&
+      (lhs.bound == rhs.bound);
+}
+
+bool operator!=(const ComplexitySample &lhs, const ComplexitySample &rhs) {
+  return !(lhs == rhs);
+}
+
+void measureComplexity(double n,
+                       const std::function<void()> &expression,
+                       Maybe<Complexity> bound) {
+  using Clock = std::chrono::steady_clock;
+  auto best = Clock::duration::max();
+  for (int i = 0; i < kComplexityAttempts; i++) {
+    const auto start = Clock::now();
+    expression();
+    best = std::min(best, Clock::now() - start);
+  }
+
+  ComplexitySample sample;
+  sample.n = n;
+  sample.seconds = std::chrono::duration<double>(best).count();
+  sample.bound = bound;
+  ImplicitParam<param::CurrentPropertyContext>::value()->addComplexitySample(
+      sample);
+}
+
+} // namespace detail
+} // namespace rc
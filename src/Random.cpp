@@ -5,6 +5,9 @@
 #include <functional>
 
 #include "rapidcheck/Show.h"
+#include "rapidcheck/detail/Platform.h"
+
+#include "detail/ChoiceSource.h"
 
 // A lot of this code is taken from https://github.com/wernerd/Skein3Fish but
 // highly modified.
@@ -14,6 +17,13 @@ namespace {
 
 constexpr uint64_t kKeyScheduleParity = 0x1BD11BDAA9FC1A22ULL;
 constexpr uint64_t kTweak[2] = {13, 37};
+
+// Kept out of line so that `Random::next` stays small when no source is
+// installed, which is the common case
+RC_INTERNAL_NOINLINE uint64_t nextChoice(detail::ChoiceSource &source,
+                                         uint64_t value) {
+  return source.next(value);
+}
 }
 
 Random::Random()
@@ -51,7 +61,13 @@ Random::Number Random::next() {
     m_counter++;
   }
 
-  return m_block[blki];
+  const auto value = m_block[blki];
+  const auto source = detail::ChoiceSource::current();
+  if (RC_INTERNAL_UNLIKELY(source != nullptr)) {
+    return nextChoice(*source, value);
+  }
+
+  return value;
 }
 
 void Random::append(bool x) {
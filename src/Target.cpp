@@ -0,0 +1,34 @@
+#include "rapidcheck/Target.h"
+
+#include <sstream>
+
+#include "rapidcheck/Assertions.h"
+#include "rapidcheck/detail/ImplicitParam.h"
+#include "rapidcheck/detail/PropertyContext.h"
+
+namespace rc {
+namespace detail {
+
+void target(const std::string & /*file*/,
+            int /*line*/,
+            const std::string & /*assertion*/,
+            double value) {
+  ImplicitParam<param::CurrentPropertyContext>::value()->addTarget(value);
+}
+
+void target(const std::string &file,
+            int line,
+            const std::string &assertion,
+            double value,
+            double threshold) {
+  ImplicitParam<param::CurrentPropertyContext>::value()->addTarget(value);
+  if (value > threshold) {
+    std::ostringstream ss;
+    ss << "Target value " << value << " exceeds threshold " << threshold;
+    throw CaseResult(CaseResult::Type::Failure,
+                     makeMessage(file, line, assertion, ss.str()));
+  }
+}
+
+} // namespace detail
+} // namespace rc
@@ -0,0 +1,108 @@
+#include "rapidcheck/detail/AliasTable.h"
+
+#include <algorithm>
+#include <cmath>
+#include <limits>
+
+namespace rc {
+namespace detail {
+
+AliasTable::AliasTable(const std::vector<std::size_t> &frequencies)
+    : m_sum(0) {
+  for (auto x : frequencies) {
+    m_sum += x;
+  }
+
+  const auto n = frequencies.size();
+  if ((m_sum == 0) || (n == 0)) {
+    return;
+  }
+
+  // Scale all weights by n so that a column that is completely full has
+  // exactly the weight `full`. This keeps the partitioning in exact integer
+  // arithmetic. Weights that are so large that this would overflow are first
+  // scaled down, which loses less precision than the 32-bit thresholds do.
+  const auto maxFull = std::numeric_limits<std::uint64_t>::max() / n;
+  int shift = 0;
+  while ((shift < 63) &&
+         (((static_cast<std::uint64_t>(m_sum) >> shift) + n) > maxFull)) {
+    shift++;
+  }
+
+  std::uint64_t full = 0;
+  std::vector<std::uint64_t> scaled;
+  scaled.reserve(n);
+  for (const auto x : frequencies) {
+    auto weight = static_cast<std::uint64_t>(x) >> shift;
+    if ((weight == 0) && (x != 0)) {
+      // Possible choices must stay possible
+      weight = 1;
+    }
+    full += weight;
+    scaled.push_back(weight * n);
+  }
+
+  std::vector<std::size_t> small;
+  std::vector<std::size_t> large;
+  for (std::size_t i = 0; i < n; i++) {
+    if (scaled[i] < full) {
+      small.push_back(i);
+    } else {
+      large.push_back(i);
+    }
+  }
+
+  std::vector<std::uint64_t> weights(n, full);
+  m_columns.resize(n);
+  for (std::size_t i = 0; i < n; i++) {
+    m_columns[i].alias = i;
+  }
+
+  while (!small.empty() && !large.empty()) {
+    const auto less = small.back();
+    small.pop_back();
+    const auto more = large.back();
+    large.pop_back();
+
+    weights[less] = scaled[less];
+    m_columns[less].alias = more;
+    scaled[more] = (scaled[more] + scaled[less]) - full;
+    if (scaled[more] < full) {
+      small.push_back(more);
+    } else {
+      large.push_back(more);
+    }
+  }
+  // Whatever remains now fills its column completely
+
+  const auto kOne = static_cast<std::uint64_t>(1) << 32;
+  for (std::size_t i = 0; i < n; i++) {
+    if (weights[i] == full) {
+      m_columns[i].threshold = kOne;
+    } else if (weights[i] == 0) {
+      // Must never be picked
+      m_columns[i].threshold = 0;
+    } else {
+      const auto fraction =
+          static_cast<double>(weights[i]) / static_cast<double>(full);
+      const auto threshold =
+          static_cast<std::uint64_t>(std::ldexp(fraction, 32));
+      // Make sure that rounding never turns a possible choice into an
+      // impossible one or vice versa
+      m_columns[i].threshold = std::min(std::max<std::uint64_t>(threshold, 1),
+                                        kOne - 1);
+    }
+  }
+}
+
+std::size_t AliasTable::lookup(std::uint64_t x) const {
+  const auto column = static_cast<std::size_t>(
+      ((x >> 32) * static_cast<std::uint64_t>(m_columns.size())) >> 32);
+  const auto &entry = m_columns[column];
+  return ((x & 0xFFFFFFFFULL) < entry.threshold) ? column : entry.alias;
+}
+
+std::size_t AliasTable::sum() const { return m_sum; }
+
+} // namespace detail
+} // namespace rc
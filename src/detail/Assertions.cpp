@@ -1,7 +1,29 @@
 #include "rapidcheck/Assertions.h"
 
+#include <algorithm>
+#include <sstream>
+
+#include "rapidcheck/detail/ImplicitParam.h"
+#include "rapidcheck/detail/PropertyContext.h"
+
 namespace rc {
 namespace detail {
+namespace {
+
+void showDuration(std::chrono::nanoseconds duration, std::ostream &os) {
+  const auto ns = static_cast<double>(duration.count());
+  if (ns < 1e3) {
+    os << ns << " ns";
+  } else if (ns < 1e6) {
+    os << (ns / 1e3) << " us";
+  } else if (ns < 1e9) {
+    os << (ns / 1e6) << " ms";
+  } else {
+    os << (ns / 1e9) << " s";
+  }
+}
+
+} // namespace
 
 std::string makeMessage(const std::string &file,
                         int line,
@@ -41,5 +63,53 @@ std::string makeWrongExceptionMessage(const std::string &file,
                      "Thrown exception did not match " + expected + ".");
 }
 
+std::string makeBudgetMessage(const std::string &file,
+                              int line,
+                              const std::string &assertion,
+                              int attempts,
+                              std::chrono::nanoseconds elapsed,
+                              std::chrono::nanoseconds budget) {
+  std::ostringstream ss;
+  if (attempts > 1) {
+    ss << "The fastest of " << attempts << " attempts took ";
+  } else {
+    ss << "Took ";
+  }
+  showDuration(elapsed, ss);
+  ss << " but the budget is ";
+  showDuration(budget, ss);
+  ss << ".";
+  return makeMessage(file, line, assertion, ss.str());
+}
+
+void assertWithin(std::chrono::nanoseconds budget,
+                  int attempts,
+                  const std::function<void()> &expression,
+                  const std::string &file,
+                  int line,
+                  const std::string &assertion) {
+  using Clock = std::chrono::steady_clock;
+  auto best = std::chrono::nanoseconds::max();
+  attempts = std::max(attempts, 1);
+  for (int i = 0; (i < attempts) && (best > budget); i++) {
+    const auto start = Clock::now();
+    expression();
+    const auto elapsed =
+        std::chrono::duration_cast<std::chrono::nanoseconds>(Clock::now() -
+                                                             start);
+    best = std::min(best, elapsed);
+  }
+
+  const auto fraction = (budget.count() > 0)
+      ? (static_cast<double>(best.count()) / budget.count())
+      : static_cast<double>(best.count());
+  ImplicitParam<param::CurrentPropertyContext>::value()->addTarget(fraction);
+  if (best > budget) {
+    throw CaseResult(CaseResult::Type::Failure,
+                     makeBudgetMessage(
+                         file, line, assertion, attempts, best, budget));
+  }
+}
+
 } // namespace detail
 } // namespace rc
@@ -0,0 +1,166 @@
+#include "ChoiceShrinking.h"
+
+#include <algorithm>
+
+namespace rc {
+namespace detail {
+namespace {
+
+bool isSimpler(const Choices &lhs, const Choices &rhs) {
+  if (lhs.size() != rhs.size()) {
+    return lhs.size() < rhs.size();
+  }
+
+  return std::lexicographical_compare(
+      begin(lhs), end(lhs), begin(rhs), end(rhs));
+}
+
+// Block sizes to try, largest first since removing a whole block is usually
+// needed to remove a value that is generated from several choices.
+const std::size_t kBlockSizes[] = {8, 4, 2, 1};
+
+class ChoiceShrinker {
+public:
+  ChoiceShrinker(Choices choices, const std::function<bool(Choices &)> &test)
+      : m_choices(std::move(choices))
+      , m_test(test) {}
+
+  Choices shrink() {
+    bool progress = true;
+    while (progress) {
+      progress = deleteBlocks();
+      progress = zeroBlocks() || progress;
+      progress = sortBlocks() || progress;
+      progress = minimizeChoices() || progress;
+    }
+
+    return std::move(m_choices);
+  }
+
+private:
+  bool tryCandidate(Choices candidate) {
+    if (!isSimpler(candidate, m_choices) || !m_test(candidate)) {
+      return false;
+    }
+
+    m_choices = std::move(candidate);
+    return true;
+  }
+
+  bool deleteBlocks() {
+    bool progress = false;
+    for (const auto k : kBlockSizes) {
+      // Going backwards means that the blocks that are left to try are not
+      // affected by deletions
+      for (auto end = m_choices.size(); end >= k; end--) {
+        end = std::min(end, m_choices.size());
+        if (end < k) {
+          break;
+        }
+
+        auto candidate = m_choices;
+        candidate.erase(begin(candidate) + (end - k), begin(candidate) + end);
+        progress = tryCandidate(std::move(candidate)) || progress;
+      }
+    }
+
+    return progress;
+  }
+
+  bool zeroBlocks() {
+    bool progress = false;
+    for (const auto k : kBlockSizes) {
+      for (std::size_t i = 0; (i + k) <= m_choices.size(); i++) {
+        const auto first = begin(m_choices) + i;
+        if (std::all_of(
+                first, first + k, [](std::uint64_t x) { return x == 0; })) {
+          continue;
+        }
+
+        auto candidate = m_choices;
+        std::fill(begin(candidate) + i, begin(candidate) + i + k, 0);
+        progress = tryCandidate(std::move(candidate)) || progress;
+      }
+    }
+
+    return progress;
+  }
+
+  bool sortBlocks() {
+    bool progress = false;
+    for (const auto k : kBlockSizes) {
+      if (k == 1) {
+        continue;
+      }
+
+      for (std::size_t i = 0; (i + k) <= m_choices.size(); i++) {
+        const auto first = begin(m_choices) + i;
+        if (std::is_sorted(first, first + k)) {
+          continue;
+        }
+
+        auto candidate = m_choices;
+        std::sort(begin(candidate) + i, begin(candidate) + i + k);
+        progress = tryCandidate(std::move(candidate)) || progress;
+      }
+    }
+
+    return progress;
+  }
+
+  bool minimizeChoices() {
+    bool progress = false;
+    for (std::size_t i = 0; i < m_choices.size(); i++) {
+      const auto value = m_choices[i];
+      if (value == 0) {
+        continue;
+      }
+
+      // Zero is the most likely to succeed and if one less than the value
+      // fails, the value is most likely already minimal so we avoid searching
+      if (tryChoice(i, 0)) {
+        progress = true;
+        continue;
+      }
+      if (!tryChoice(i, value - 1)) {
+        continue;
+      }
+
+      // Binary search for the smallest value that still fails. Choices are not
+      // necessarily monotonic in this but since every accepted candidate is
+      // simpler, this is still sound.
+      progress = true;
+      std::uint64_t lo = 1;
+      std::uint64_t hi = value - 1;
+      while ((lo < hi) && (i < m_choices.size())) {
+        const auto mid = lo + ((hi - lo) / 2);
+        if (tryChoice(i, mid)) {
+          hi = mid;
+        } else {
+          lo = mid + 1;
+        }
+      }
+    }
+
+    return progress;
+  }
+
+  bool tryChoice(std::size_t i, std::uint64_t value) {
+    auto candidate = m_choices;
+    candidate[i] = value;
+    return tryCandidate(std::move(candidate));
+  }
+
+  Choices m_choices;
+  const std::function<bool(Choices &)> &m_test;
+};
+
+} // namespace
+
+Choices shrinkChoices(Choices choices,
+                      const std::function<bool(Choices &)> &test) {
+  return ChoiceShrinker(std::move(choices), test).shrink();
+}
+
+} // namespace detail
+} // namespace rc
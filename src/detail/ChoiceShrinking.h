@@ -0,0 +1,27 @@
+#pragma once
+
+#include <functional>
+
+#include "ChoiceSource.h"
+
+namespace rc {
+namespace detail {
+
+/// Shrinks the choices of a failing test case by repeatedly deleting blocks of
+/// choices, zeroing blocks, sorting blocks and minimizing individual choices
+/// until no further progress can be made.
+///
+/// Every candidate is either shorter or lexicographically smaller than the
+/// current choices which guarantees termination.
+///
+/// @param choices  The choices of the failing test case.
+/// @param test     Called with each candidate, should return `true` if the
+///                 candidate still fails. If so, it may also truncate the
+///                 candidate to the choices that were actually used.
+///
+/// @return The smallest failing choices that were found.
+Choices shrinkChoices(Choices choices,
+                      const std::function<bool(Choices &)> &test);
+
+} // namespace detail
+} // namespace rc
@@ -0,0 +1,70 @@
+#include "ChoiceSource.h"
+
+namespace rc {
+namespace detail {
+
+Choices choicesFromBytes(const std::uint8_t *data, std::size_t size) {
+  Choices choices((size + 7) / 8, 0);
+  for (std::size_t i = 0; i < size; i++) {
+    choices[i / 8] |= static_cast<std::uint64_t>(data[i]) << ((i % 8) * 8);
+  }
+  return choices;
+}
+
+ChoiceSource::ChoiceSource()
+    : m_index(0)
+    , m_replay(false)
+    , m_overrun(false) {}
+
+ChoiceSource::ChoiceSource(Choices choices)
+    : m_choices(std::move(choices))
+    , m_index(0)
+    , m_replay(true)
+    , m_overrun(false) {
+  m_indexes.reserve(m_choices.size());
+}
+
+std::uint64_t ChoiceSource::next(std::uint64_t value) {
+  const auto it = m_indexes.find(value);
+  if (it != end(m_indexes)) {
+    return m_choices[it->second];
+  }
+
+  m_indexes.emplace(value, m_index);
+  if (m_observer) {
+    m_observer(value);
+  }
+
+  if (m_index < m_choices.size()) {
+    return m_choices[m_index++];
+  }
+
+  m_overrun = m_overrun || m_replay;
+  m_choices.push_back(value);
+  m_index++;
+  return value;
+}
+
+const Choices &ChoiceSource::choices() const { return m_choices; }
+
+std::size_t ChoiceSource::numUsed() const { return m_index; }
+
+bool ChoiceSource::overrun() const { return m_overrun; }
+
+bool ChoiceSource::replaying() const { return m_replay; }
+
+void ChoiceSource::setObserver(std::function<void(std::uint64_t)> observer) {
+  m_observer = std::move(observer);
+}
+
+thread_local ChoiceSource *ChoiceSource::m_current = nullptr;
+
+ChoiceSourceScope::ChoiceSourceScope(ChoiceSource &source)
+    : m_previous(ChoiceSource::m_current) {
+  ChoiceSource::m_current = &source;
+}
+
+ChoiceSourceScope::~ChoiceSourceScope() { ChoiceSource::m_current = m_previous; }
+
+} // namespace detail
+} // namespace rc
@@ -0,0 +1,96 @@
+#pragma once
+
+#include <cstdint>
+#include <functional>
+#include <unordered_map>
+#include <vector>
+
+namespace rc {
+namespace detail {
+
+/// A flat sequence of the raw 64-bit values drawn from `Random` while
+/// generating a test case.
+using Choices = std::vector<std::uint64_t>;
+
+/// Converts raw bytes, such as those provided by a fuzzer, to choices. Every
+/// eight bytes form one choice in little-endian order and a trailing partial
+/// choice is padded with zeros.
+Choices choicesFromBytes(const std::uint8_t *data, std::size_t size);
+
+/// While installed using `ChoiceSourceScope`, every value drawn using
+/// `Random::next` on the same thread passes through the current
+/// `ChoiceSource`. A recording source
+/// remembers each value so that the test case can later be replayed by a
+/// replaying source which instead returns the values it was given, in order.
+///
+/// Generators are pure functions of their `Random` and values are frequently
+/// generated more than once from copies of the same `Random`. For this reason,
+/// a choice is made once per distinct `Random` state, identified by the value
+/// it would return, and repeated draws from that state give the same choice.
+class ChoiceSource {
+public:
+  /// Creates a source that records all drawn values.
+  ChoiceSource();
+
+  /// Creates a source that replays the given choices.
+  explicit ChoiceSource(Choices choices);
+
+  /// Called by `Random::next` with the value it would return, returns the value
+  /// that should actually be used. When a replaying source runs out of
+  /// choices, it is marked as overrun and continues by recording the given
+  /// values so that generation still terminates.
+  std::uint64_t next(std::uint64_t value);
+
+  /// The recorded or replayed choices, including those recorded after an
+  /// overrun.
+  const Choices &choices() const;
+
+  /// The number of distinct choices that have been used so far.
+  std::size_t numUsed() const;
+
+  /// Returns `true` if a replaying source has been asked for more choices than
+  /// it has.
+  bool overrun() const;
+
+  /// Returns `true` if this source replays given choices rather than recording
+  /// the values drawn from `Random`.
+  bool replaying() const;
+
+  /// Sets a function that is called with the value given to `next` every time
+  /// a new choice is made. Passing the same values to `next` of another source
+  /// in the same state brings it to the same state as this one.
+  void setObserver(std::function<void(std::uint64_t)> observer);
+
+  /// Returns the source installed for the current scope or `nullptr` if there
+  /// is none.
+  static ChoiceSource *current() { return m_current; }
+
+private:
+  friend class ChoiceSourceScope;
+
+  Choices m_choices;
+  std::unordered_map<std::uint64_t, std::size_t> m_indexes;
+  std::size_t m_index;
+  bool m_replay;
+  bool m_overrun;
+  std::function<void(std::uint64_t)> m_observer;
+
+  static thread_local ChoiceSource *m_current;
+};
+
+/// Installs a `ChoiceSource` for the duration of the scope, restoring the
+/// previous one on destruction.
+class ChoiceSourceScope {
+public:
+  explicit ChoiceSourceScope(ChoiceSource &source);
+  ~ChoiceSourceScope();
+
+  ChoiceSourceScope(const ChoiceSourceScope &) = delete;
+  ChoiceSourceScope &operator=(const ChoiceSourceScope &) = delete;
+
+private:
+  ChoiceSource *m_previous;
+};
+
+} // namespace detail
+} // namespace rc
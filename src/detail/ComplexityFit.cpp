@@ -0,0 +1,91 @@
+#include "ComplexityFit.h"
+
+#include <algorithm>
+#include <cmath>
+#include <set>
+
+namespace rc {
+namespace detail {
+namespace {
+
+// How much worse than the best fit a less complex class may fit and still be
+// preferred
+constexpr double kTolerance = 0.1;
+
+double curve(Complexity complexity, double n) {
+  switch (complexity) {
+  case Complexity::Constant:
+    return 1.0;
+  case Complexity::Linear:
+    return n;
+  case Complexity::Linearithmic:
+    return (n > 1.0) ? (n * std::log2(n)) : 0.0;
+  case Complexity::Quadratic:
+    return n * n;
+  }
+  return 0.0;
+}
+
+/// Returns the residual sum of squares of the least squares fit of
+/// `a + b * curve(n)` with `b >= 0`.
+double residual(Complexity complexity,
+                const std::vector<ComplexitySample> &samples) {
+  const auto count = static_cast<double>(samples.size());
+  double meanX = 0.0;
+  double meanY = 0.0;
+  for (const auto &sample : samples) {
+    meanX += curve(complexity, sample.n) / count;
+    meanY += sample.seconds / count;
+  }
+
+  double sxx = 0.0;
+  double sxy = 0.0;
+  for (const auto &sample : samples) {
+    const auto dx = curve(complexity, sample.n) - meanX;
+    sxx += dx * dx;
+    sxy += dx * (sample.seconds - meanY);
+  }
+
+  // Runtime that decreases with the size is best described by a constant
+  const auto slope = ((sxx > 0.0) && (sxy > 0.0)) ? (sxy / sxx) : 0.0;
+  double rss = 0.0;
+  for (const auto &sample : samples) {
+    const auto fitted = meanY + slope * (curve(complexity, sample.n) - meanX);
+    const auto error = sample.seconds - fitted;
+    rss += error * error;
+  }
+  return rss;
+}
+
+} // namespace
+
+Maybe<Complexity> fitComplexity(const std::vector<ComplexitySample> &samples) {
+  std::set<double> sizes;
+  for (const auto &sample : samples) {
+    sizes.insert(sample.n);
+  }
+  if (sizes.size() < 3) {
+    return Nothing;
+  }
+
+  // In order of increasing complexity
+  const std::vector<Complexity> classes{Complexity::Constant,
+                                        Complexity::Linear,
+                                        Complexity::Linearithmic,
+                                        Complexity::Quadratic};
+  std::vector<double> residuals;
+  for (const auto complexity : classes) {
+    residuals.push_back(residual(complexity, samples));
+  }
+
+  const auto bestResidual =
+      *std::min_element(begin(residuals), end(residuals));
+  std::size_t i = 0;
+  while (residuals[i] > (bestResidual * (1.0 + kTolerance))) {
+    i++;
+  }
+  return classes[i];
+}
+
+} // namespace detail
+} // namespace rc
@@ -0,0 +1,20 @@
+#pragma once
+
+#include <vector>
+
+#include "rapidcheck/Complexity.h"
+#include "rapidcheck/Maybe.h"
+
+namespace rc {
+namespace detail {
+
+/// Fits the curves of the different complexity classes to the given samples
+/// using least squares and returns the class that fits best. Since the curves
+/// of more complex classes can always be made to fit at least about as well,
+/// the least complex class that fits almost as well as the best one is
+/// preferred. Returns `Nothing` if the samples have fewer than three distinct
+/// input sizes.
+Maybe<Complexity> fitComplexity(const std::vector<ComplexitySample> &samples);
+
+} // namespace detail
+} // namespace rc
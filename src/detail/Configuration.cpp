@@ -14,6 +14,7 @@
 #include "MapParser.h"
 #include "ParseException.h"
 #include "StringSerialization.h"
+#include "rapidcheck/Show.h"
 #include "rapidcheck/detail/Platform.h"
 
 namespace rc {
@@ -58,8 +59,9 @@ void fromString(const std::string &str,
   try {
     out = stringToReproduceMap(str);
     ok = true;
-  } catch (const ParseException &) {
-    ok = false;
+  } catch (const ParseException &e) {
+    throw ConfigurationException("'reproduce' string has invalid format: " +
+                                 e.message());
   }
 }
 
@@ -90,6 +92,11 @@ bool isNonNegative(T x) {
   return x >= 0;
 }
 
+template <typename T>
+bool isPositive(T x) {
+  return x > 0;
+}
+
 template <typename T>
 bool anything(const T &) {
   return true;
@@ -129,6 +136,66 @@ Configuration configFromMap(const std::map<std::string, std::string> &map,
             "'noshrink' must be either '1' or '0'",
             anything<bool>);
 
+  loadParam(map,
+            "shrink_engine",
+            config.testParams.shrinkEngine,
+            "'shrink_engine' must be one of 'tree' or 'choices'",
+            anything<ShrinkEngine>);
+
+  loadParam(map,
+            "size_schedule",
+            config.testParams.sizeSchedule,
+            "'size_schedule' must be one of 'linear', 'exponential' or "
+            "'adaptive'",
+            anything<SizeSchedule>);
+
+  loadParam(map,
+            "coverage_guided",
+            config.testParams.coverageGuided,
+            "'coverage_guided' must be either '1' or '0'",
+            anything<bool>);
+
+  loadParam(map,
+            "fail_fast",
+            config.testParams.failFast,
+            "'fail_fast' must be either '1' or '0'",
+            anything<bool>);
+
+  loadParam(map,
+            "shard_count",
+            config.testParams.shardCount,
+            "'shard_count' must be a valid positive integer",
+            isPositive<int>);
+
+  loadParam(map,
+            "shard_index",
+            config.testParams.shardIndex,
+            "'shard_index' must be a valid non-negative integer",
+            isNonNegative<int>);
+
+  if (config.testParams.shardIndex >= config.testParams.shardCount) {
+    throw ConfigurationException(
+        "'shard_index' must be less than 'shard_count'");
+  }
+
+  loadParam(map,
+            "case_timeout_ms",
+            config.testParams.caseTimeoutMs,
+            "'case_timeout_ms' must be a valid non-negative integer",
+            isNonNegative<int>);
+
+  loadParam(map,
+            "isolation",
+            config.testParams.isolation,
+            "'isolation' must be one of 'none' or 'fork'",
+            anything<CaseIsolation>);
+
+  loadParam(map,
+            "memory_limit_mb",
+            config.testParams.memoryLimitMb,
+            "'memory_limit_mb' must be a valid non-negative integer",
+            isNonNegative<int>);
+
   loadParam(map,
             "verbose_progress",
             config.verboseProgress,
@@ -157,6 +224,15 @@ std::map<std::string, std::string> mapFromConfig(const Configuration &config) {
       {"max_size", std::to_string(config.testParams.maxSize)},
       {"max_discard_ratio", std::to_string(config.testParams.maxDiscardRatio)},
       {"noshrink", config.testParams.disableShrinking ? "1" : "0"},
+      {"shrink_engine", toString(config.testParams.shrinkEngine)},
+      {"size_schedule", toString(config.testParams.sizeSchedule)},
+      {"coverage_guided", config.testParams.coverageGuided ? "1" : "0"},
+      {"fail_fast", config.testParams.failFast ? "1" : "0"},
+      {"shard_index", std::to_string(config.testParams.shardIndex)},
+      {"shard_count", std::to_string(config.testParams.shardCount)},
+      {"case_timeout_ms", std::to_string(config.testParams.caseTimeoutMs)},
+      {"isolation", toString(config.testParams.isolation)},
+      {"memory_limit_mb", std::to_string(config.testParams.memoryLimitMb)},
       {"verbose_progress", std::to_string(config.verboseProgress)},
       {"verbose_shrinking", std::to_string(config.verboseShrinking)},
       {"reproduce", reproduceMapToString(config.reproduce)}};
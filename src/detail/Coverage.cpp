@@ -0,0 +1,165 @@
+#include "Coverage.h"
+
+#include <algorithm>
+
+#include "rapidcheck/detail/BoundedRandom.h"
+
+namespace rc {
+namespace detail {
+namespace {
+
+// Function local static since counters are registered during static
+// initialization
+std::vector<CounterRegion> &counterRegions() {
+  static std::vector<CounterRegion> regions;
+  return regions;
+}
+
+// Like libFuzzer, hit counts are bucketed so that only significant changes in
+// the number of hits count as new coverage
+std::uint8_t bucketOf(std::uint8_t count) {
+  if (count >= 128) {
+    return 1 << 7;
+  } else if (count >= 32) {
+    return 1 << 6;
+  } else if (count >= 16) {
+    return 1 << 5;
+  } else if (count >= 8) {
+    return 1 << 4;
+  } else if (count >= 4) {
+    return 1 << 3;
+  } else if (count == 3) {
+    return 1 << 2;
+  }
+  return count;
+}
+
+} // namespace
+
+void registerCoverageCounters(std::uint8_t *start, std::uint8_t *end) {
+  if (start != end) {
+    counterRegions().push_back(CounterRegion{start, end});
+  }
+}
+
+void unregisterCoverageCounters(std::uint8_t *start) {
+  auto &regions = counterRegions();
+  regions.erase(std::remove_if(begin(regions),
+                               end(regions),
+                               [=](const CounterRegion &region) {
+                                 return region.start == start;
+                               }),
+                end(regions));
+}
+
+CoverageTracker::CoverageTracker()
+    : m_regions(counterRegions()) {
+  std::size_t numCounters = 0;
+  for (const auto &region : m_regions) {
+    numCounters += region.end - region.start;
+  }
+  m_seen.resize(numCounters, 0);
+}
+
+bool CoverageTracker::enabled() const { return !m_seen.empty(); }
+
+void CoverageTracker::beginCase() {
+  for (const auto &region : m_regions) {
+    std::fill(region.start, region.end, 0);
+  }
+}
+
+bool CoverageTracker::endCase() {
+  bool newCoverage = false;
+  auto seen = begin(m_seen);
+  for (const auto &region : m_regions) {
+    for (auto counter = region.start; counter != region.end;
+         counter++, seen++) {
+      const auto bucket = bucketOf(*counter);
+      if ((*seen & bucket) != bucket) {
+        *seen |= bucket;
+        newCoverage = true;
+      }
+    }
+  }
+
+  return newCoverage;
+}
+
+void CoverageCorpus::add(Choices choices, int size) {
+  m_entries.push_back(Entry{std::move(choices), size});
+}
+
+bool CoverageCorpus::empty() const { return m_entries.empty(); }
+
+CoverageCorpus::Entry CoverageCorpus::mutate(Random &random) const {
+  auto entry = m_entries[nextBounded(random, m_entries.size())];
+  const auto numMutations = 1 + nextBounded(random, 4);
+  for (Random::Number n = 0; n < numMutations; n++) {
+    mutateChoices(entry.choices, random);
+  }
+
+  return entry;
+}
+
+void mutateChoices(Choices &choices, Random &random) {
+  if (choices.empty()) {
+    choices.push_back(random.next());
+    return;
+  }
+
+  const auto i = nextBounded(random, choices.size());
+  const auto blockSize =
+      std::min<std::size_t>(1 + nextBounded(random, 8), choices.size() - i);
+  switch (nextBounded(random, 7)) {
+  case 0:
+    choices.insert(begin(choices) + nextBounded(random, choices.size() + 1),
+                   random.next());
+    break;
+  case 1:
+    choices[i] = random.next();
+    break;
+  case 2:
+    choices[i] ^= 1ULL << nextBounded(random, 64);
+    break;
+  case 3:
+    choices[i] = 0;
+    break;
+  case 4:
+    choices.erase(begin(choices) + i, begin(choices) + i + blockSize);
+    break;
+  case 5: {
+    const Choices block(begin(choices) + i, begin(choices) + i + blockSize);
+    choices.insert(begin(choices) + nextBounded(random, choices.size() + 1),
+                   begin(block),
+                   end(block));
+    break;
+  }
+  case 6: {
+    // Generators mostly use the high bits so nudging a choice by a small
+    // amount at some bit position usually nudges the generated value too
+    const auto delta = (1 + nextBounded(random, 16))
+        << nextBounded(random, 60);
+    if (nextBounded(random, 2) == 0) {
+      choices[i] += delta;
+    } else {
+      choices[i] -= delta;
+    }
+    break;
+  }
+  }
+}
+
+} // namespace detail
+} // namespace rc
+
+#if defined(__GNUC__) || defined(__clang__)
+// Called for every module compiled with
+// -fsanitize-coverage=inline-8bit-counters. This is weak so that it does not
+// conflict with fuzzing engines, such as libFuzzer, that also define it.
+extern "C" __attribute__((weak)) void
+__sanitizer_cov_8bit_counters_init(char *start, char *end) {
+  rc::detail::registerCoverageCounters(reinterpret_cast<std::uint8_t *>(start),
+                                       reinterpret_cast<std::uint8_t *>(end));
+}
+#endif
@@ -0,0 +1,80 @@
+#pragma once
+
+#include <cstdint>
+#include <vector>
+
+#include "rapidcheck/Random.h"
+
+#include "ChoiceSource.h"
+
+namespace rc {
+namespace detail {
+
+/// A contiguous region of coverage counters.
+struct CounterRegion {
+  std::uint8_t *start;
+  std::uint8_t *end;
+};
+
+/// Registers a region of SanitizerCoverage inline 8-bit counters. This is
+/// called by `__sanitizer_cov_8bit_counters_init` for every module that is
+/// compiled with `-fsanitize-coverage=inline-8bit-counters`.
+void registerCoverageCounters(std::uint8_t *start, std::uint8_t *end);
+
+/// Unregisters a region previously registered using
+/// `registerCoverageCounters`.
+void unregisterCoverageCounters(std::uint8_t *start);
+
+/// Keeps track of which features, i.e. pairs of counter and bucketed hit
+/// count, have been reached by the test cases run so far.
+class CoverageTracker {
+public:
+  /// Creates a tracker for the currently registered counters.
+  CoverageTracker();
+
+  /// Returns `true` if there are any counters to track.
+  bool enabled() const;
+
+  /// Resets all counters, call this before running a test case.
+  void beginCase();
+
+  /// Returns `true` if the test case that was run since the last call to
+  /// `beginCase` reached any features that have not been reached before.
+  bool endCase();
+
+private:
+  std::vector<CounterRegion> m_regions;
+  std::vector<std::uint8_t> m_seen;
+};
+
+/// A corpus of the choices of test cases that reached new coverage, used to
+/// produce new test cases by mutating them.
+class CoverageCorpus {
+public:
+  struct Entry {
+    /// The choices of the test case.
+    Choices choices;
+    /// The size the test case was generated with.
+    int size;
+  };
+
+  /// Adds the given test case to the corpus.
+  void add(Choices choices, int size);
+
+  /// Returns `true` if the corpus has no entries.
+  bool empty() const;
+
+  /// Picks an entry of the corpus and returns a mutated copy of it. The corpus
+  /// must not be empty.
+  Entry mutate(Random &random) const;
+
+private:
+  std::vector<Entry> m_entries;
+};
+
+/// Applies a single random mutation to the given choices, for example
+/// inserting, replacing, nudging or deleting some of them.
+void mutateChoices(Choices &choices, Random &random);
+
+} // namespace detail
+} // namespace rc
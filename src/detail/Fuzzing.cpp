@@ -0,0 +1,45 @@
+#include "rapidcheck/detail/Fuzzing.h"
+
+#include "Testing.h"
+
+namespace rc {
+namespace detail {
+
+TestResult fuzzProperty(const Property &property,
+                        const std::uint8_t *data,
+                        std::size_t size) {
+  ChoiceSource source(choicesFromBytes(data, size));
+  auto caseDescription =
+      runWithChoices(property, Random(), kNominalSize, source);
+
+  switch (caseDescription.result.type) {
+  case CaseResult::Type::Failure: {
+    FailureResult failure;
+    failure.numSuccess = 0;
+    failure.description = std::move(caseDescription.result.description);
+    Reproduce reproduce;
+    reproduce.size = kNominalSize;
+    reproduce.choices = source.choices();
+    failure.reproduce = std::move(reproduce);
+    failure.counterExample = caseDescription.example();
+    return failure;
+  }
+
+  case CaseResult::Type::Discard: {
+    GaveUpResult gaveUp;
+    gaveUp.numSuccess = 0;
+    gaveUp.description = std::move(caseDescription.result.description);
+    return gaveUp;
+  }
+
+  case CaseResult::Type::Success:
+    break;
+  }
+
+  SuccessResult success;
+  success.numSuccess = 1;
+  return success;
+}
+
+} // namespace detail
+} // namespace rc
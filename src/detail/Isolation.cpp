@@ -0,0 +1,831 @@
+#include "Isolation.h"
+
+#ifndef _WIN32
+
+#include <poll.h>
+#include <signal.h>
+#include <sys/resource.h>
+#include <sys/socket.h>
+#include <sys/wait.h>
+#include <unistd.h>
+
+#include <cerrno>
+#include <chrono>
+#include <csignal>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <iostream>
+#include <iterator>
+#include <memory>
+#include <stdexcept>
+#include <system_error>
+
+#include "rapidcheck/detail/Serialization.h"
+
+#include "../gen/detail/IngredientObserver.h"
+#include "ChoiceSource.h"
+
+namespace rc {
+namespace detail {
+namespace {
+
+// Messages sent from the child to the parent. Each message is a kind byte
+// followed by a 32-bit payload length and the payload.
+constexpr char kChoiceMessage = 'c';
+constexpr char kIngredientMessage = 'e';
+constexpr char kResultMessage = 'r';
+// Sent by the fork server in addition to the messages of the worker
+constexpr char kWorkerMessage = 'p';
+constexpr char kExitMessage = 'x';
+// Sent by the parent to the fork server
+constexpr char kRequestMessage = 'q';
+constexpr std::size_t kHeaderSize = 5;
+
+/// How long the fork server may take to report that a killed worker has
+/// exited before the server itself is restarted.
+constexpr int kKillTimeoutMs = 1000;
+
+/// How often the fork server checks whether a worker whose output is still
+/// open has exited.
+constexpr int kRelayPollMs = 50;
+
+#ifdef MSG_NOSIGNAL
+constexpr int kSendFlags = MSG_NOSIGNAL;
+#else
+constexpr int kSendFlags = 0;
+#endif
+
+template <typename Iterator>
+Iterator serializeDouble(double value, Iterator output) {
+  std::uint64_t bits;
+  std::memcpy(&bits, &value, sizeof(bits));
+  return serialize(bits, output);
+}
+
+template <typename Iterator>
+Iterator deserializeDouble(Iterator begin, Iterator end, double &value) {
+  std::uint64_t bits;
+  const auto it = deserialize(begin, end, bits);
+  std::memcpy(&value, &bits, sizeof(bits));
+  return it;
+}
+
+std::string serializeResult(const CaseDescription &description) {
+  std::string payload;
+  auto out = std::back_inserter(payload);
+  out = serialize(static_cast<std::uint8_t>(description.result.type), out);
+  out = serialize(description.result.description, out);
+  out = serializeCompact(description.tags.size(), out);
+  for (const auto &tag : description.tags) {
+    out = serialize(tag, out);
+  }
+
+  out = serialize(static_cast<std::uint8_t>(description.target ? 1 : 0), out);
+  if (description.target) {
+    out = serializeDouble(*description.target, out);
+  }
+
+  const auto &complexity = description.complexity;
+  out = serialize(static_cast<std::uint8_t>(complexity ? 1 : 0), out);
+  if (complexity) {
+    out = serializeDouble(complexity->n, out);
+    out = serializeDouble(complexity->seconds, out);
+    out = serialize(static_cast<std::uint8_t>(complexity->bound ? 1 : 0), out);
+    if (complexity->bound) {
+      out = serialize(static_cast<std::uint8_t>(*complexity->bound), out);
+    }
+  }
+
+  return payload;
+}
+
+CaseDescription deserializeResult(const std::string &payload) {
+  CaseDescription description;
+  auto it = begin(payload);
+  const auto end = payload.end();
+  std::uint8_t byte;
+  it = deserialize(it, end, byte);
+  description.result.type = static_cast<CaseResult::Type>(byte);
+  it = deserialize(it, end, description.result.description);
+  std::size_t numTags;
+  it = deserializeCompact(it, end, numTags);
+  description.tags.resize(numTags);
+  for (auto &tag : description.tags) {
+    it = deserialize(it, end, tag);
+  }
+
+  it = deserialize(it, end, byte);
+  if (byte != 0) {
+    double target;
+    it = deserializeDouble(it, end, target);
+    description.target = target;
+  }
+
+  it = deserialize(it, end, byte);
+  if (byte != 0) {
+    ComplexitySample sample;
+    it = deserializeDouble(it, end, sample.n);
+    it = deserializeDouble(it, end, sample.seconds);
+    it = deserialize(it, end, byte);
+    if (byte != 0) {
+      it = deserialize(it, end, byte);
+      sample.bound = static_cast<Complexity>(byte);
+    }
+    description.complexity = sample;
+  }
+
+  return description;
+}
+
+void writeAll(int fd, const char *data, std::size_t size) {
+  std::size_t written = 0;
+  while (written < size) {
+    const auto n = write(fd, data + written, size - written);
+    if (n < 0) {
+      if (errno == EINTR) {
+        continue;
+      }
+      // The parent is gone, nobody is interested in the result
+      _exit(EXIT_FAILURE);
+    }
+    written += static_cast<std::size_t>(n);
+  }
+}
+
+void writeMessage(int fd, char kind, const std::string &payload) {
+  std::string message(1, kind);
+  serialize(static_cast<std::uint32_t>(payload.size()),
+            std::back_inserter(message));
+  message += payload;
+  writeAll(fd, message.data(), message.size());
+}
+
+/// Returns the number of bytes at the start of `buffer` that make up complete
+/// messages.
+std::size_t completeMessagesSize(const std::string &buffer) {
+  std::size_t pos = 0;
+  while ((buffer.size() - pos) >= kHeaderSize) {
+    std::uint32_t length;
+    deserialize(begin(buffer) + pos + 1, buffer.end(), length);
+    if ((buffer.size() - pos - kHeaderSize) < length) {
+      break;
+    }
+    pos += kHeaderSize + length;
+  }
+
+  return pos;
+}
+
+void flushOutput() {
+  std::cout.flush();
+  std::cerr.flush();
+  std::fflush(nullptr);
+}
+
+/// Prepares a freshly forked child for running a test case.
+void setUpChild(int memoryLimitMb) {
+  // Crash handlers installed by the test program, for example by the test
+  // framework, would report the crash as if the test program had crashed
+  const int crashSignals[] = {
+      SIGABRT, SIGBUS, SIGFPE, SIGILL, SIGSEGV, SIGTRAP};
+  for (const auto signal : crashSignals) {
+    std::signal(signal, SIG_DFL);
+  }
+
+  // Shrinking a crash crashes over and over again, each leaving a core dump
+  rlimit limit;
+  if (getrlimit(RLIMIT_CORE, &limit) == 0) {
+    limit.rlim_cur = 0;
+    setrlimit(RLIMIT_CORE, &limit);
+  }
+
+  if ((memoryLimitMb <= 0) || (getrlimit(RLIMIT_AS, &limit) != 0)) {
+    return;
+  }
+
+  const auto bytes = static_cast<rlim_t>(memoryLimitMb) * 1024 * 1024;
+  if ((limit.rlim_max == RLIM_INFINITY) || (bytes < limit.rlim_max)) {
+    limit.rlim_cur = bytes;
+    setrlimit(RLIMIT_AS, &limit);
+  }
+}
+
+[[noreturn]] void runCase(int fd,
+                          const Property &property,
+                          const Random &random,
+                          int size,
+                          ChoiceSource *source) {
+  // Everything the parent needs to know to continue where the child stopped
+  // is sent as soon as it is known since the child may never finish
+  if (source) {
+    source->setObserver([=](std::uint64_t value) {
+      std::string payload;
+      serialize(value, std::back_inserter(payload));
+      writeMessage(fd, kChoiceMessage, payload);
+    });
+  }
+
+  ImplicitParam<gen::detail::param::CurrentIngredientObserver> letObserver(
+      [=](const gen::detail::Recipe::Ingredient &ingredient) {
+        std::string payload;
+        serialize(describeIngredient(ingredient), std::back_inserter(payload));
+        writeMessage(fd, kIngredientMessage, payload);
+      });
+
+  const auto description = property(random, size).value();
+  writeMessage(fd, kResultMessage, serializeResult(description));
+
+  flushOutput();
+  _exit(EXIT_SUCCESS);
+}
+
+/// What the parent has received from the child so far.
+struct ChildCase {
+  Example example;
+  Maybe<CaseDescription> description;
+  /// The process running the test case and how it exited, only sent by the
+  /// fork server.
+  pid_t pid = -1;
+  Maybe<int> status;
+  int error = 0;
+};
+
+/// Handles the complete messages at the start of `buffer` and returns the
+/// number of bytes consumed.
+std::size_t handleMessages(const std::string &buffer, ChildCase &childCase) {
+  std::size_t pos = 0;
+  while ((buffer.size() - pos) >= kHeaderSize) {
+    std::uint32_t length;
+    deserialize(begin(buffer) + pos + 1, buffer.end(), length);
+    if ((buffer.size() - pos - kHeaderSize) < length) {
+      break;
+    }
+
+    const auto kind = buffer[pos];
+    const auto payload = buffer.substr(pos + kHeaderSize, length);
+    pos += kHeaderSize + length;
+
+    if (kind == kChoiceMessage) {
+      std::uint64_t value;
+      deserialize(begin(payload), payload.end(), value);
+      if (const auto source = ChoiceSource::current()) {
+        source->next(value);
+      }
+    } else if (kind == kIngredientMessage) {
+      std::pair<std::string, std::string> item;
+      deserialize(begin(payload), payload.end(), item);
+      childCase.example.push_back(std::move(item));
+    } else if (kind == kResultMessage) {
+      childCase.description = deserializeResult(payload);
+    } else if (kind == kWorkerMessage) {
+      std::int32_t pid;
+      deserialize(begin(payload), payload.end(), pid);
+      childCase.pid = static_cast<pid_t>(pid);
+    } else if (kind == kExitMessage) {
+      std::int32_t status;
+      std::int32_t error;
+      const auto it = deserialize(begin(payload), payload.end(), status);
+      deserialize(it, payload.end(), error);
+      childCase.status = status;
+      childCase.error = error;
+    }
+  }
+
+  return pos;
+}
+
+using Deadline = std::chrono::steady_clock::time_point;
+
+enum class ReadResult { Exited, Closed, TimedOut };
+
+/// Reads messages from `fd` until the fork server reports that the test case
+/// has exited, the other end is closed or `deadline` has passed.
+ReadResult readMessages(int fd,
+                        std::string &buffer,
+                        ChildCase &childCase,
+                        const Maybe<Deadline> &deadline) {
+  while (!childCase.status) {
+    int waitMs = -1;
+    if (deadline) {
+      const auto remaining = *deadline - std::chrono::steady_clock::now();
+      if (remaining <= std::chrono::steady_clock::duration::zero()) {
+        return ReadResult::TimedOut;
+      }
+      waitMs = static_cast<int>(
+          std::chrono::duration_cast<std::chrono::milliseconds>(remaining)
+              .count() +
+          1);
+    }
+
+    pollfd pfd;
+    pfd.fd = fd;
+    pfd.events = POLLIN;
+    pfd.revents = 0;
+    const auto ready = poll(&pfd, 1, waitMs);
+    if (ready == 0 || (ready < 0 && errno == EINTR)) {
+      continue;
+    }
+
+    char chunk[4096];
+    const auto n = (ready < 0) ? -1 : read(fd, chunk, sizeof(chunk));
+    if (n < 0 && errno == EINTR) {
+      continue;
+    } else if (n <= 0) {
+      return ReadResult::Closed;
+    }
+
+    buffer.append(chunk, static_cast<std::size_t>(n));
+    buffer.erase(0, handleMessages(buffer, childCase));
+  }
+
+  return ReadResult::Exited;
+}
+
+void waitForExit(pid_t pid, int &status) {
+  while ((waitpid(pid, &status, 0) < 0) && (errno == EINTR)) {
+  }
+}
+
+/// Forwards the complete messages read from `from` to `to` until the worker
+/// `pid` is done and returns its exit status. A message that was cut short
+/// because the worker was killed is dropped so that the messages sent to `to`
+/// stay intact. Processes started by the worker may keep `from` open so the
+/// relay also ends once the worker has exited and its output has been read.
+int relayMessages(int from, int to, pid_t pid) {
+  std::string buffer;
+  auto exited = false;
+  int status = 0;
+  while (true) {
+    pollfd pfd;
+    pfd.fd = from;
+    pfd.events = POLLIN;
+    const auto ready = poll(&pfd, 1, exited ? 0 : kRelayPollMs);
+    if (ready < 0) {
+      if (errno == EINTR) {
+        continue;
+      }
+      break;
+    } else if (ready == 0) {
+      if (exited) {
+        break;
+      }
+      const auto waited = waitpid(pid, &status, WNOHANG);
+      exited = (waited == pid) || ((waited < 0) && (errno != EINTR));
+      continue;
+    }
+
+    char chunk[4096];
+    const auto n = read(from, chunk, sizeof(chunk));
+    if (n < 0 && errno == EINTR) {
+      continue;
+    } else if (n <= 0) {
+      break;
+    }
+
+    buffer.append(chunk, static_cast<std::size_t>(n));
+    const auto size = completeMessagesSize(buffer);
+    writeAll(to, buffer.data(), size);
+    buffer.erase(0, size);
+  }
+
+  if (!exited) {
+    waitForExit(pid, status);
+  }
+  return status;
+}
+
+std::string signalName(int signal) {
+  switch (signal) {
+  case SIGABRT:
+    return "SIGABRT";
+  case SIGBUS:
+    return "SIGBUS";
+  case SIGFPE:
+    return "SIGFPE";
+  case SIGILL:
+    return "SIGILL";
+  case SIGKILL:
+    return "SIGKILL";
+  case SIGSEGV:
+    return "SIGSEGV";
+  case SIGTERM:
+    return "SIGTERM";
+  case SIGTRAP:
+    return "SIGTRAP";
+  }
+
+  return "signal " + std::to_string(signal);
+}
+
+std::string describeStatus(int status) {
+  if (WIFSIGNALED(status)) {
+    const auto signal = WTERMSIG(status);
+    auto description = "Test case was terminated by " + signalName(signal);
+    if (const auto name = strsignal(signal)) {
+      description += " (" + std::string(name) + ")";
+    }
+    return description;
+  }
+
+  return "Test case exited with status " +
+      std::to_string(WEXITSTATUS(status)) + " without reporting a result";
+}
+
+CaseDescription makeDescription(ChildCase &&childCase,
+                                int status,
+                                bool timedOut,
+                                int timeoutMs) {
+  CaseDescription description;
+  if (timedOut) {
+    description.result =
+        CaseResult(CaseResult::Type::Failure,
+                   "Test case timed out after " + std::to_string(timeoutMs) +
+                       " ms");
+  } else if (childCase.description) {
+    description = std::move(*childCase.description);
+  } else {
+    description.result =
+        CaseResult(CaseResult::Type::Failure, describeStatus(status));
+  }
+
+  // Values generated before the child stopped are still worth showing
+  const auto example = std::move(childCase.example);
+  description.example = [=] { return example; };
+  return description;
+}
+
+Maybe<Deadline> deadlineAfter(int timeoutMs) {
+  if (timeoutMs <= 0) {
+    return Nothing;
+  }
+
+  return std::chrono::steady_clock::now() +
+      std::chrono::milliseconds(timeoutMs);
+}
+
+/// Runs a single test case in a child forked directly from this process.
+CaseDescription runForked(const Property &property,
+                          const Random &random,
+                          int size,
+                          int timeoutMs,
+                          int memoryLimitMb) {
+  int fds[2];
+  if (pipe(fds) != 0) {
+    throw std::system_error(errno, std::generic_category(), "pipe");
+  }
+
+  // Anything still buffered would otherwise be printed by both processes
+  flushOutput();
+
+  const auto pid = fork();
+  if (pid < 0) {
+    const auto error = errno;
+    close(fds[0]);
+    close(fds[1]);
+    throw std::system_error(error, std::generic_category(), "fork");
+  } else if (pid == 0) {
+    close(fds[0]);
+    setUpChild(memoryLimitMb);
+    runCase(fds[1], property, random, size, ChoiceSource::current());
+  }
+  close(fds[1]);
+
+  ChildCase childCase;
+  std::string buffer;
+  const auto timedOut =
+      readMessages(fds[0], buffer, childCase, deadlineAfter(timeoutMs)) ==
+      ReadResult::TimedOut;
+  close(fds[0]);
+
+  if (timedOut) {
+    kill(pid, SIGKILL);
+  }
+  int status = 0;
+  waitForExit(pid, status);
+
+  return makeDescription(std::move(childCase), status, timedOut, timeoutMs);
+}
+
+/// A test case for the fork server to run.
+struct ForkRequest {
+  Random random;
+  int size = 0;
+  /// Whether the choices should be sent back, only if the parent has a
+  /// `ChoiceSource` to pass them on to.
+  bool observed = false;
+  bool replay = false;
+  Choices choices;
+};
+
+std::string serializeRequest(const ForkRequest &request) {
+  std::string payload;
+  auto out = std::back_inserter(payload);
+  out = serialize(request.random, out);
+  out = serialize(static_cast<std::int32_t>(request.size), out);
+  out = serialize(static_cast<std::uint8_t>(request.observed ? 1 : 0), out);
+  out = serialize(static_cast<std::uint8_t>(request.replay ? 1 : 0), out);
+  serializeCompact(begin(request.choices), end(request.choices), out);
+  return payload;
+}
+
+ForkRequest deserializeRequest(const std::string &payload) {
+  ForkRequest request;
+  auto it = begin(payload);
+  const auto end = payload.end();
+  it = deserialize(it, end, request.random);
+  std::int32_t size;
+  it = deserialize(it, end, size);
+  request.size = size;
+  std::uint8_t byte;
+  it = deserialize(it, end, byte);
+  request.observed = byte != 0;
+  it = deserialize(it, end, byte);
+  request.replay = byte != 0;
+  deserializeCompact<std::uint64_t>(
+      it, end, std::back_inserter(request.choices));
+  return request;
+}
+
+/// Takes the first request from `buffer` if it has been received completely.
+bool takeRequest(std::string &buffer, ForkRequest &request) {
+  if (buffer.size() < kHeaderSize) {
+    return false;
+  }
+
+  std::uint32_t length;
+  deserialize(begin(buffer) + 1, buffer.end(), length);
+  if ((buffer.size() - kHeaderSize) < length) {
+    return false;
+  }
+
+  request = deserializeRequest(buffer.substr(kHeaderSize, length));
+  buffer.erase(0, kHeaderSize + length);
+  return true;
+}
+
+/// A process forked from the test program once per property which in turn
+/// forks a worker for every test case it is asked to run. The cost of forking
+/// grows with the memory of the process being forked so this keeps test cases
+/// cheap even when the test program grows while testing. The output of workers
+/// is relayed by the server. The server itself is restarted if it dies or if it
+/// doesn't report a killed worker in time.
+class ForkServer {
+public:
+  ForkServer(Property property, const TestParams &params)
+      : m_property(std::move(property))
+      , m_timeoutMs(params.caseTimeoutMs)
+      , m_memoryLimitMb(params.memoryLimitMb)
+      , m_fd(-1)
+      , m_pid(-1) {}
+
+  ~ForkServer() { stop(); }
+
+  ForkServer(const ForkServer &) = delete;
+  ForkServer &operator=(const ForkServer &) = delete;
+
+  CaseDescription run(const Random &random, int size) {
+    // The workers start with a fresh ChoiceSource so a source that has
+    // already been used can't be continued in one
+    const auto source = ChoiceSource::current();
+    if (source && (source->numUsed() != 0)) {
+      return runForked(m_property, random, size, m_timeoutMs, m_memoryLimitMb);
+    }
+
+    ForkRequest request;
+    request.random = random;
+    request.size = size;
+    if (source) {
+      request.observed = true;
+      request.replay = source->replaying();
+      request.choices = source->choices();
+    }
+    const auto payload = serializeRequest(request);
+    if (!sendRequest(payload)) {
+      stop();
+      if (!sendRequest(payload)) {
+        stop();
+        throw std::runtime_error("Failed to send test case to fork server");
+      }
+    }
+
+    ChildCase childCase;
+    std::string buffer;
+    auto result =
+        readMessages(m_fd, buffer, childCase, deadlineAfter(m_timeoutMs));
+    const auto timedOut = result == ReadResult::TimedOut;
+    if (timedOut && (childCase.pid > 0)) {
+      kill(childCase.pid, SIGKILL);
+      result = readMessages(
+          m_fd, buffer, childCase, deadlineAfter(kKillTimeoutMs));
+    }
+
+    if (result == ReadResult::TimedOut) {
+      // Either the worker is not known yet or the server did not report its
+      // exit, the server is restarted in both cases
+      stop();
+    } else if (result == ReadResult::Closed) {
+      stop();
+      if (!timedOut) {
+        throw std::runtime_error("Fork server terminated unexpectedly");
+      }
+    } else if (childCase.error != 0) {
+      throw std::system_error(
+          childCase.error, std::generic_category(), "fork");
+    }
+
+    const auto status = childCase.status ? *childCase.status : 0;
+    return makeDescription(std::move(childCase), status, timedOut, m_timeoutMs);
+  }
+
+private:
+  bool sendRequest(const std::string &payload) {
+    if (m_pid < 0) {
+      start();
+    }
+
+    std::string message(1, kRequestMessage);
+    serialize(static_cast<std::uint32_t>(payload.size()),
+              std::back_inserter(message));
+    message += payload;
+
+    std::size_t sent = 0;
+    while (sent < message.size()) {
+      const auto n = send(
+          m_fd, message.data() + sent, message.size() - sent, kSendFlags);
+      if (n < 0) {
+        if (errno == EINTR) {
+          continue;
+        }
+        return false;
+      }
+      sent += static_cast<std::size_t>(n);
+    }
+
+    return true;
+  }
+
+  void start() {
+    int fds[2];
+    if (socketpair(AF_UNIX, SOCK_STREAM, 0, fds) != 0) {
+      throw std::system_error(errno, std::generic_category(), "socketpair");
+    }
+
+    flushOutput();
+    const auto pid = fork();
+    if (pid < 0) {
+      const auto error = errno;
+      close(fds[0]);
+      close(fds[1]);
+      throw std::system_error(error, std::generic_category(), "fork");
+    } else if (pid == 0) {
+      close(fds[0]);
+      setpgid(0, 0);
+      serve(fds[1]);
+    }
+    close(fds[1]);
+    // The server and its workers get a process group of their own so that
+    // stopping the server also stops a worker the server never reported.
+    // Both sides set it since either may get to run first.
+    setpgid(pid, pid);
+
+#ifdef SO_NOSIGPIPE
+    int on = 1;
+    setsockopt(fds[0], SOL_SOCKET, SO_NOSIGPIPE, &on, sizeof(on));
+#endif
+
+    m_fd = fds[0];
+    m_pid = pid;
+  }
+
+  void stop() {
+    if (m_pid < 0) {
+      return;
+    }
+
+    close(m_fd);
+    // Servers of other properties may hold a copy of our end of the socket so
+    // the server can't be relied on to notice that it has been closed
+    kill(-m_pid, SIGKILL);
+    int status;
+    waitForExit(m_pid, status);
+    m_fd = -1;
+    m_pid = -1;
+  }
+
+  [[noreturn]] void serve(int fd) {
+    try {
+      std::string buffer;
+      while (true) {
+        ForkRequest request;
+        while (!takeRequest(buffer, request)) {
+          char chunk[4096];
+          const auto n = read(fd, chunk, sizeof(chunk));
+          if (n < 0 && errno == EINTR) {
+            continue;
+          } else if (n <= 0) {
+            _exit(EXIT_SUCCESS);
+          }
+          buffer.append(chunk, static_cast<std::size_t>(n));
+        }
+
+        // Workers write to a pipe of their own which the server relays from.
+        // A worker that is killed while writing can then only cut its own
+        // message short and not the messages of the server.
+        int fds[2] = {-1, -1};
+        auto pid = pid_t(-1);
+        if (pipe(fds) == 0) {
+          pid = fork();
+        }
+        const auto forkError = errno;
+        if (pid == 0) {
+          close(fd);
+          close(fds[0]);
+          runWorker(fds[1], request);
+        }
+
+        std::int32_t status = 0;
+        std::int32_t error = 0;
+        if (pid < 0) {
+          error = forkError;
+          if (fds[0] >= 0) {
+            close(fds[0]);
+            close(fds[1]);
+          }
+        } else {
+          close(fds[1]);
+          std::string payload;
+          serialize(static_cast<std::int32_t>(pid),
+                    std::back_inserter(payload));
+          writeMessage(fd, kWorkerMessage, payload);
+          status = relayMessages(fds[0], fd, pid);
+          close(fds[0]);
+        }
+
+        std::string payload;
+        auto out = std::back_inserter(payload);
+        out = serialize(status, out);
+        serialize(error, out);
+        writeMessage(fd, kExitMessage, payload);
+      }
+    } catch (...) {
+      _exit(EXIT_FAILURE);
+    }
+  }
+
+  [[noreturn]] void runWorker(int fd, const ForkRequest &request) {
+    setUpChild(m_memoryLimitMb);
+    // The current source, if any, was inherited from the test program when
+    // the server was started and has nothing to do with this test case
+    ChoiceSource source =
+        request.replay ? ChoiceSource(request.choices) : ChoiceSource();
+    ChoiceSourceScope scope(source);
+    runCase(fd,
+            m_property,
+            request.random,
+            request.size,
+            request.observed ? &source : nullptr);
+  }
+
+  Property m_property;
+  int m_timeoutMs;
+  int m_memoryLimitMb;
+  int m_fd;
+  pid_t m_pid;
+};
+
+} // namespace
+
+Property isolateProperty(const Property &property, const TestParams &params) {
+  if (params.isolation != CaseIsolation::Fork) {
+    return property;
+  }
+
+  // The server is started when the first test case is run
+  const auto server = std::make_shared<ForkServer>(property, params);
+  return [=](const Random &random, int size) {
+    return shrinkable::lambda([=] { return server->run(random, size); });
+  };
+}
+
+bool isolationAvailable() { return true; }
+
+} // namespace detail
+} // namespace rc
+
+#else // _WIN32
+
+namespace rc {
+namespace detail {
+
+Property isolateProperty(const Property &property,
+                         const TestParams & /*params*/) {
+  return property;
+}
+
+bool isolationAvailable() { return false; }
+
+} // namespace detail
+} // namespace rc
+
+#endif // _WIN32
@@ -0,0 +1,28 @@
+#pragma once
+
+#include "rapidcheck/detail/Property.h"
+#include "rapidcheck/detail/TestParams.h"
+
+namespace rc {
+namespace detail {
+
+/// Returns a property that runs each test case of `property` in a forked child
+/// process according to `TestParams::isolation`. Test cases that run for longer
+/// than `TestParams::caseTimeoutMs` are killed and fail, as do test cases that
+/// terminate without reporting a result, such as those that crash. The address
+/// space of the child is limited to `TestParams::memoryLimitMb`.
+///
+/// Children are forked from a server process which is started when the first
+/// test case is run and stopped when the returned property is destroyed.
+///
+/// The values drawn from `Random` in the child are passed on to the current
+/// `ChoiceSource` of the parent so the returned property can be shrunk by
+/// shrinking choices. It has no shrinks of its own. On platforms without
+/// `fork`, `property` is returned unchanged.
+Property isolateProperty(const Property &property, const TestParams &params);
+
+/// Returns `true` if `isolateProperty` can isolate test cases on this platform.
+bool isolationAvailable();
+
+} // namespace detail
+} // namespace rc
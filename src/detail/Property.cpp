@@ -48,14 +48,28 @@ bool AdapterContext::reportResult(const CaseResult &result) {
 }
 
 std::ostream &AdapterContext::logStream() {
-  return m_logStream;
+  if (!m_logStream) {
+    m_logStream.reset(new std::ostringstream());
+  }
+  return *m_logStream;
 }
 
 void AdapterContext::addTag(std::string str) {
   m_tags.push_back(std::move(str));
 }
 
-TaggedResult AdapterContext::result() const {
+void AdapterContext::addTarget(double value) {
+  // Only the highest value of a test case counts
+  if (!m_target || (value > *m_target)) {
+    m_target = value;
+  }
+}
+
+void AdapterContext::addComplexitySample(const ComplexitySample &sample) {
+  m_complexity = sample;
+}
+
+TaggedResult AdapterContext::result() {
   TaggedResult result;
   result.result.type = m_resultType;
   for (auto it = begin(m_messages); it != end(m_messages); it++) {
@@ -65,20 +79,65 @@ TaggedResult AdapterContext::result() const {
     result.result.description += std::move(*it);
   }
 
-  const auto log = m_logStream.str();
-  if (!log.empty()) {
-    result.result.description += "\n\nLog:\n";
-    result.result.description += log;
+  if (m_logStream) {
+    const auto log = m_logStream->str();
+    if (!log.empty()) {
+      result.result.description += "\n\nLog:\n";
+      result.result.description += log;
+    }
   }
 
   result.tags = std::move(m_tags);
+  result.target = m_target;
+  result.complexity = m_complexity;
   return result;
 }
 
+void AdapterContext::reset() {
+  m_resultType = CaseResult::Type::Success;
+  m_messages.clear();
+  m_tags.clear();
+  m_target.reset();
+  m_complexity.reset();
+  if (m_logStream) {
+    m_logStream->str(std::string());
+    m_logStream->clear();
+    // Don't let formatting flags set by one test case leak into the next one
+    m_logStream->copyfmt(std::ios(nullptr));
+  }
+}
+
+namespace {
+
+// Contexts that are not currently in use by this thread.
+std::vector<std::unique_ptr<AdapterContext>> &freeAdapterContexts() {
+  static thread_local std::vector<std::unique_ptr<AdapterContext>> contexts;
+  return contexts;
+}
+
+} // namespace
+
+ScopedAdapterContext::ScopedAdapterContext() {
+  auto &contexts = freeAdapterContexts();
+  if (contexts.empty()) {
+    m_context = new AdapterContext();
+  } else {
+    m_context = contexts.back().release();
+    contexts.pop_back();
+  }
+}
+
+ScopedAdapterContext::~ScopedAdapterContext() {
+  m_context->reset();
+  freeAdapterContexts().emplace_back(m_context);
+}
+
 bool operator==(const CaseDescription &lhs, const CaseDescription &rhs) {
   const bool equalExample = (!lhs.example && !rhs.example) ||
       (lhs.example && rhs.example && (lhs.example() == rhs.example()));
-  return (lhs.result == rhs.result) && (lhs.tags == rhs.tags) && equalExample;
+  return (lhs.result == rhs.result) && (lhs.tags == rhs.tags) &&
+      (lhs.target == rhs.target) && (lhs.complexity == rhs.complexity) &&
+      equalExample;
 }
 
 bool operator!=(const CaseDescription &lhs, const CaseDescription &rhs) {
@@ -87,6 +146,12 @@ bool operator!=(const CaseDescription &lhs, const CaseDescription &rhs) {
 
 std::ostream &operator<<(std::ostream &os, const CaseDescription &desc) {
   os << "{result='" << desc.result << "', tags=" << toString(desc.tags);
+  if (desc.target) {
+    os << ", target=" << *desc.target;
+  }
+  if (desc.complexity) {
+    os << ", complexity=" << *desc.complexity;
+  }
   if (desc.example) {
     os << ", example=" << toString(desc.example());
   }
@@ -115,7 +180,8 @@ std::pair<std::string, std::string>
 tryDescribeIngredientValue(const gen::detail::Recipe::Ingredient &ingredient) {
   const auto value = ingredient.shrinkable.value();
 
-  std::string description = ingredient.description;
+  std::string description =
+      ingredient.description ? *ingredient.description : std::string();
   if (description.empty()) {
     std::ostringstream typeString;
     value.showType(typeString);
@@ -128,6 +194,8 @@ tryDescribeIngredientValue(const gen::detail::Recipe::Ingredient &ingredient) {
   return {description, valueString.str()};
 }
 
+} // namespace
+
 std::pair<std::string, std::string>
 describeIngredient(const gen::detail::Recipe::Ingredient &ingredient) {
   // TODO I don't know if this is the right approach with counterexamples
@@ -143,6 +211,29 @@ describeIngredient(const gen::detail::Recipe::Ingredient &ingredient) {
   }
 }
 
+namespace {
+
+/// Renders the counterexample on demand. Nothing is shown until the example
+/// is actually requested which is typically only for the minimal failure.
+class ExampleRenderer {
+public:
+  explicit ExampleRenderer(gen::detail::Recipe::Ingredients &&ingredients)
+      : m_ingredients(std::move(ingredients)) {}
+
+  Example operator()() const {
+    Example example;
+    example.reserve(m_ingredients.size());
+    std::transform(begin(m_ingredients),
+                   end(m_ingredients),
+                   std::back_inserter(example),
+                   &describeIngredient);
+    return example;
+  }
+
+private:
+  gen::detail::Recipe::Ingredients m_ingredients;
+};
+
 } // namespace
 
 Gen<CaseDescription>
@@ -152,18 +243,10 @@ mapToCaseDescription(Gen<std::pair<TaggedResult, gen::detail::Recipe>> gen) {
                     CaseDescription description;
                     description.result = std::move(p.first.result);
                     description.tags = std::move(p.first.tags);
-
-                    const auto ingredients = std::move(p.second.ingredients);
-                    description.example = [ingredients] {
-                      Example example;
-                      example.reserve(ingredients.size());
-                      std::transform(begin(ingredients),
-                                     end(ingredients),
-                                     std::back_inserter(example),
-                                     &describeIngredient);
-                      return example;
-                    };
-
+                    description.target = p.first.target;
+                    description.complexity = p.first.complexity;
+                    description.example =
+                        ExampleRenderer(std::move(p.second.ingredients));
                     return description;
                   });
 }
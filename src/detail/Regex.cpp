@@ -0,0 +1,519 @@
+#include "Regex.h"
+
+#include <algorithm>
+#include <cctype>
+
+#include "rapidcheck/detail/BoundedRandom.h"
+
+#include "ParseException.h"
+
+namespace rc {
+namespace detail {
+
+constexpr std::uint32_t RegexProgram::kUnbounded;
+
+namespace {
+
+/// The characters that `.` and negated classes pick from, simplest first since
+/// shrinking moves towards the start.
+const std::string kUniverse =
+    "abcdefghijklmnopqrstuvwxyzABCDEFGHIJKLMNOPQRSTUVWXYZ0123456789 "
+    "!\"#$%&'()*+,-./:;<=>?@[\\]^_`{|}~\t\n\r";
+
+const std::string kDigits = "0123456789";
+const std::string kWordChars =
+    "abcdefghijklmnopqrstuvwxyzABCDEFGHIJKLMNOPQRSTUVWXYZ0123456789_";
+const std::string kSpaceChars = " \t\n\r\f\v";
+
+/// The maximum number of characters and repetitions that a pattern may require
+/// regardless of size.
+constexpr std::uint64_t kMaxRequiredSteps = 1000000;
+
+std::string complementOf(const std::string &chars) {
+  std::string result;
+  for (const char c : kUniverse) {
+    if (chars.find(c) == std::string::npos) {
+      result += c;
+    }
+  }
+  return result;
+}
+
+class RegexParser {
+public:
+  RegexParser(const std::string &pattern, RegexProgram &program)
+      : m_pattern(pattern)
+      , m_pos(0)
+      , m_program(program) {}
+
+  std::uint32_t parse() {
+    if (peek('^')) {
+      m_pos++;
+    }
+    const auto root = parseAlternation();
+    if (peek('$')) {
+      m_pos++;
+    }
+    if (!atEnd()) {
+      fail(m_pattern[m_pos] == ')' ? "Unmatched ')'"
+                                   : "Unexpected character");
+    }
+    return root;
+  }
+
+private:
+  bool atEnd() const { return m_pos >= m_pattern.size(); }
+
+  bool peek(char c) const { return !atEnd() && (m_pattern[m_pos] == c); }
+
+  char take() {
+    if (atEnd()) {
+      fail("Unexpected end of pattern");
+    }
+    return m_pattern[m_pos++];
+  }
+
+  [[noreturn]] void fail(const std::string &msg) const {
+    throw ParseException(m_pos, msg);
+  }
+
+  std::uint32_t addNode(RegexProgram::Op op,
+                        std::uint32_t first,
+                        std::uint32_t count,
+                        std::uint32_t max = 0) {
+    // Nested repetition counts multiply so they are only bounded in total
+    std::uint64_t steps = 0;
+    switch (op) {
+    case RegexProgram::Op::Chars:
+      steps = 1;
+      break;
+
+    case RegexProgram::Op::Concat:
+      for (std::uint32_t i = 0; i < count; i++) {
+        steps += m_steps[m_program.children[first + i]];
+      }
+      break;
+
+    case RegexProgram::Op::Alternate:
+      // Any of the alternatives may be chosen
+      for (std::uint32_t i = 0; i < count; i++) {
+        steps = std::max(steps, m_steps[m_program.children[first + i]]);
+      }
+      break;
+
+    case RegexProgram::Op::Repeat:
+      steps = 1 + std::uint64_t(count) * m_steps[first];
+      break;
+    }
+    if (steps > kMaxRequiredSteps) {
+      fail("Pattern requires too many repetitions");
+    }
+
+    m_steps.push_back(steps);
+    m_program.nodes.push_back(RegexProgram::Node{op, first, count, max});
+    return static_cast<std::uint32_t>(m_program.nodes.size() - 1);
+  }
+
+  std::uint32_t addChars(const std::string &chars) {
+    if (chars.empty()) {
+      fail("Character class matches nothing");
+    }
+    const auto first = static_cast<std::uint32_t>(m_program.chars.size());
+    m_program.chars += chars;
+    return addNode(RegexProgram::Op::Chars,
+                   first,
+                   static_cast<std::uint32_t>(chars.size()));
+  }
+
+  std::uint32_t addList(RegexProgram::Op op,
+                        const std::vector<std::uint32_t> &nodes) {
+    if ((nodes.size() == 1) && (op == RegexProgram::Op::Concat)) {
+      return nodes.front();
+    }
+    const auto first = static_cast<std::uint32_t>(m_program.children.size());
+    m_program.children.insert(
+        end(m_program.children), begin(nodes), end(nodes));
+    return addNode(op, first, static_cast<std::uint32_t>(nodes.size()));
+  }
+
+  std::uint32_t parseAlternation() {
+    std::vector<std::uint32_t> alternatives;
+    alternatives.push_back(parseConcatenation());
+    while (peek('|')) {
+      m_pos++;
+      alternatives.push_back(parseConcatenation());
+    }
+
+    return (alternatives.size() == 1)
+        ? alternatives.front()
+        : addList(RegexProgram::Op::Alternate, alternatives);
+  }
+
+  std::uint32_t parseConcatenation() {
+    std::vector<std::uint32_t> items;
+    while (!atEnd() && !peek('|') && !peek(')') && !peek('$')) {
+      items.push_back(parseRepetition());
+    }
+    return addList(RegexProgram::Op::Concat, items);
+  }
+
+  std::uint32_t parseRepetition() {
+    auto node = parseAtom();
+    while (!atEnd()) {
+      std::uint32_t min;
+      std::uint32_t max;
+      const auto c = m_pattern[m_pos];
+      if (c == '*') {
+        min = 0;
+        max = RegexProgram::kUnbounded;
+        m_pos++;
+      } else if (c == '+') {
+        min = 1;
+        max = RegexProgram::kUnbounded;
+        m_pos++;
+      } else if (c == '?') {
+        min = 0;
+        max = 1;
+        m_pos++;
+      } else if (c == '{') {
+        m_pos++;
+        min = parseNumber();
+        max = min;
+        if (peek(',')) {
+          m_pos++;
+          max = peek('}') ? RegexProgram::kUnbounded : parseNumber();
+        }
+        if (take() != '}') {
+          fail("Expected '}'");
+        }
+        if (max < min) {
+          fail("Invalid repetition range");
+        }
+      } else {
+        break;
+      }
+
+      // Lazy and possessive modifiers make no difference when generating
+      if (peek('?') || peek('+')) {
+        m_pos++;
+      }
+      node = addNode(RegexProgram::Op::Repeat, node, min, max);
+    }
+
+    return node;
+  }
+
+  std::uint32_t parseNumber() {
+    const auto start = m_pos;
+    std::uint32_t n = 0;
+    while (!atEnd() && std::isdigit(static_cast<unsigned char>(m_pattern[m_pos]))) {
+      n = n * 10 + static_cast<std::uint32_t>(m_pattern[m_pos] - '0');
+      if (n > 100000) {
+        fail("Repetition count too large");
+      }
+      m_pos++;
+    }
+    if (m_pos == start) {
+      fail("Expected number");
+    }
+    return n;
+  }
+
+  std::uint32_t parseAtom() {
+    const auto c = take();
+    switch (c) {
+    case '(':
+      return parseGroup();
+    case '[':
+      return addChars(parseClass());
+    case '.':
+      return addChars(complementOf("\n\r"));
+    case '\\':
+      return addChars(parseEscape(false));
+    case '*':
+    case '+':
+    case '?':
+    case '{':
+      m_pos--;
+      fail("Nothing to repeat");
+    case '^':
+    case '$':
+      m_pos--;
+      fail("Anchors are only supported at the start and end");
+    default:
+      return addChars(std::string(1, c));
+    }
+  }
+
+  std::uint32_t parseGroup() {
+    if (peek('?')) {
+      m_pos++;
+      if (take() != ':') {
+        fail("Only non-capturing groups are supported");
+      }
+    }
+    const auto node = parseAlternation();
+    if (take() != ')') {
+      fail("Expected ')'");
+    }
+    return node;
+  }
+
+  /// Parses the part of an escape after the backslash.
+  std::string parseEscape(bool inClass) {
+    const auto c = take();
+    switch (c) {
+    case 'd':
+      return kDigits;
+    case 'D':
+      return complementOf(kDigits);
+    case 'w':
+      return kWordChars;
+    case 'W':
+      return complementOf(kWordChars);
+    case 's':
+      return kSpaceChars;
+    case 'S':
+      return complementOf(kSpaceChars);
+    case 'n':
+      return "\n";
+    case 't':
+      return "\t";
+    case 'r':
+      return "\r";
+    case 'f':
+      return "\f";
+    case 'v':
+      return "\v";
+    case '0':
+      return std::string(1, '\0');
+    case 'x': {
+      std::string digits;
+      digits += take();
+      digits += take();
+      if (!std::isxdigit(static_cast<unsigned char>(digits[0])) ||
+          !std::isxdigit(static_cast<unsigned char>(digits[1]))) {
+        fail("Expected two hex digits");
+      }
+      return std::string(1, static_cast<char>(std::stoi(digits, nullptr, 16)));
+    }
+    default:
+      if (std::isalnum(static_cast<unsigned char>(c)) && !(inClass && c == 'b')) {
+        m_pos--;
+        fail("Unsupported escape");
+      }
+      return std::string(1, (inClass && c == 'b') ? '\b' : c);
+    }
+  }
+
+  std::string parseClass() {
+    const bool negated = peek('^');
+    if (negated) {
+      m_pos++;
+    }
+
+    std::string chars;
+    const auto add = [&](char c) {
+      if (chars.find(c) == std::string::npos) {
+        chars += c;
+      }
+    };
+
+    bool first = true;
+    while (first || !peek(']')) {
+      first = false;
+      auto c = take();
+      if (c == '\\') {
+        const auto escaped = parseEscape(true);
+        if (escaped.size() != 1) {
+          for (const auto x : escaped) {
+            add(x);
+          }
+          continue;
+        }
+        c = escaped[0];
+      }
+
+      if (peek('-') && ((m_pos + 1) < m_pattern.size()) &&
+          (m_pattern[m_pos + 1] != ']')) {
+        m_pos++;
+        auto last = take();
+        if (last == '\\') {
+          const auto escaped = parseEscape(true);
+          if (escaped.size() != 1) {
+            fail("Invalid range end");
+          }
+          last = escaped[0];
+        }
+        const auto from = static_cast<unsigned char>(c);
+        const auto to = static_cast<unsigned char>(last);
+        if (to < from) {
+          fail("Invalid range");
+        }
+        for (unsigned x = from; x <= to; x++) {
+          add(static_cast<char>(x));
+        }
+      } else {
+        add(c);
+      }
+    }
+    m_pos++;
+
+    return negated ? complementOf(chars) : chars;
+  }
+
+  const std::string &m_pattern;
+  std::string::size_type m_pos;
+  RegexProgram &m_program;
+  /// For every node, the number of characters and repetitions that are always
+  /// generated for it, regardless of size.
+  std::vector<std::uint64_t> m_steps;
+};
+
+class ChoiceGenerator {
+public:
+  ChoiceGenerator(const RegexProgram &program, const Random &random, int size)
+      : m_program(program)
+      , m_random(random)
+      , m_budget(static_cast<std::size_t>(std::max(size, 0)))
+      , m_emitted(0) {}
+
+  std::vector<std::uint32_t> generate() {
+    generate(m_program.root);
+    return std::move(m_choices);
+  }
+
+private:
+  std::uint32_t choose(std::uint64_t n) {
+    const auto choice =
+        static_cast<std::uint32_t>(nextBounded(m_random, n));
+    m_choices.push_back(choice);
+    return choice;
+  }
+
+  void generate(std::uint32_t index) {
+    const auto &node = m_program.nodes[index];
+    switch (node.op) {
+    case RegexProgram::Op::Chars:
+      // Literals need no choice
+      if (node.count > 1) {
+        choose(node.count);
+      }
+      m_emitted++;
+      break;
+
+    case RegexProgram::Op::Concat:
+      for (std::uint32_t i = 0; i < node.count; i++) {
+        generate(m_program.children[node.first + i]);
+      }
+      break;
+
+    case RegexProgram::Op::Alternate:
+      generate(m_program.children[node.first + choose(node.count)]);
+      break;
+
+    case RegexProgram::Op::Repeat: {
+      const auto limit = (node.max == RegexProgram::kUnbounded)
+          ? std::uint64_t(m_budget)
+          : std::uint64_t(node.max - node.count);
+      // The number of extra repetitions is recorded after the fact since we
+      // may stop early when running out of budget.
+      const auto slot = m_choices.size();
+      m_choices.push_back(0);
+      const auto extra = nextBounded(m_random, limit + 1);
+      std::uint32_t n = 0;
+      while (n < (node.count + extra)) {
+        if ((n >= node.count) && (m_emitted >= m_budget)) {
+          break;
+        }
+        generate(node.first);
+        n++;
+      }
+      m_choices[slot] = n - node.count;
+      break;
+    }
+    }
+  }
+
+  const RegexProgram &m_program;
+  Random m_random;
+  std::size_t m_budget;
+  std::size_t m_emitted;
+  std::vector<std::uint32_t> m_choices;
+};
+
+class ChoiceInterpreter {
+public:
+  ChoiceInterpreter(const RegexProgram &program,
+                    const std::vector<std::uint32_t> &choices)
+      : m_program(program)
+      , m_choices(choices)
+      , m_pos(0) {}
+
+  std::string interpret() {
+    interpret(m_program.root);
+    return std::move(m_result);
+  }
+
+private:
+  std::uint32_t next() {
+    return (m_pos < m_choices.size()) ? m_choices[m_pos++] : 0;
+  }
+
+  void interpret(std::uint32_t index) {
+    const auto &node = m_program.nodes[index];
+    switch (node.op) {
+    case RegexProgram::Op::Chars:
+      m_result += m_program.chars[node.first +
+                                  ((node.count > 1) ? (next() % node.count) : 0)];
+      break;
+
+    case RegexProgram::Op::Concat:
+      for (std::uint32_t i = 0; i < node.count; i++) {
+        interpret(m_program.children[node.first + i]);
+      }
+      break;
+
+    case RegexProgram::Op::Alternate:
+      interpret(m_program.children[node.first + (next() % node.count)]);
+      break;
+
+    case RegexProgram::Op::Repeat: {
+      auto extra = next();
+      if (node.max != RegexProgram::kUnbounded) {
+        extra = std::min(extra, node.max - node.count);
+      }
+      for (std::uint32_t i = 0; i < (node.count + extra); i++) {
+        interpret(node.first);
+      }
+      break;
+    }
+    }
+  }
+
+  const RegexProgram &m_program;
+  const std::vector<std::uint32_t> &m_choices;
+  std::size_t m_pos;
+  std::string m_result;
+};
+
+} // namespace
+
+std::vector<std::uint32_t> RegexProgram::generate(const Random &random,
+                                                  int size) const {
+  return ChoiceGenerator(*this, random, size).generate();
+}
+
+std::string
+RegexProgram::interpret(const std::vector<std::uint32_t> &choices) const {
+  return ChoiceInterpreter(*this, choices).interpret();
+}
+
+RegexProgram compileRegex(const std::string &pattern) {
+  RegexProgram program;
+  program.root = RegexParser(pattern, program).parse();
+  return program;
+}
+
+} // namespace detail
+} // namespace rc
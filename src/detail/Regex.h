@@ -0,0 +1,56 @@
+#pragma once
+
+#include <cstdint>
+#include <string>
+#include <vector>
+
+#include "rapidcheck/Random.h"
+
+namespace rc {
+namespace detail {
+
+/// A regular expression compiled into flat tables. Strings are not generated
+/// directly but as a sequence of choices (which alternative, how many
+/// repetitions, which character) that is then interpreted into a string. Every
+/// sequence of choices yields a string that matches the expression which means
+/// that the choices can be shrunk freely.
+class RegexProgram {
+public:
+  enum class Op : std::uint8_t { Chars, Concat, Alternate, Repeat };
+
+  static constexpr std::uint32_t kUnbounded = 0xFFFFFFFF;
+
+  struct Node {
+    Op op;
+    /// For `Chars`, the offset into the character table. For `Concat` and
+    /// `Alternate`, the offset into the child table. For `Repeat`, the index
+    /// of the repeated node.
+    std::uint32_t first;
+    /// For `Chars`, `Concat` and `Alternate`, the number of characters or
+    /// children. For `Repeat`, the minimum number of repetitions.
+    std::uint32_t count;
+    /// For `Repeat`, the maximum number of repetitions or `kUnbounded`.
+    std::uint32_t max;
+  };
+
+  std::vector<Node> nodes;
+  std::vector<std::uint32_t> children;
+  std::string chars;
+  std::uint32_t root;
+
+  /// Generates a random sequence of choices. Repetitions stop early when the
+  /// number of characters exceeds `size`.
+  std::vector<std::uint32_t> generate(const Random &random, int size) const;
+
+  /// Returns the string described by the given choices. Missing choices are
+  /// treated as zero.
+  std::string interpret(const std::vector<std::uint32_t> &choices) const;
+};
+
+/// Compiles the given regular expression.
+///
+/// @throws ParseException  If the expression is invalid or unsupported.
+RegexProgram compileRegex(const std::string &pattern);
+
+} // namespace detail
+} // namespace rc
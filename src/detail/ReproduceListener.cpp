@@ -15,8 +15,8 @@ void ReproduceListener::onTestFinished(const TestMetadata &metadata,
   }
 
   FailureResult failure;
-  if (result.match(failure)) {
-    m_reproduceMap.emplace(metadata.id, failure.reproduce);
+  if (result.match(failure) && failure.reproduce) {
+    m_reproduceMap.emplace(metadata.id, *failure.reproduce);
   }
 }
 
@@ -56,26 +56,47 @@ bool operator!=(const CaseResult &r1, const CaseResult &r2) {
 
 std::ostream &operator<<(std::ostream &os, const detail::Reproduce &r) {
   os << "random={" << r.random << "}, size=" << r.size
-     << ", shrinkPath=" << toString(r.shrinkPath);
+     << ", shrinkPath=" << toString(r.shrinkPath)
+     << ", choices=" << toString(r.choices);
   return os;
 }
 
 bool operator==(const Reproduce &lhs, const Reproduce &rhs) {
   return (lhs.random == rhs.random) && (lhs.size == rhs.size) &&
-      (lhs.shrinkPath == rhs.shrinkPath);
+      (lhs.shrinkPath == rhs.shrinkPath) && (lhs.choices == rhs.choices);
 }
 
 bool operator!=(const Reproduce &lhs, const Reproduce &rhs) {
   return !(lhs == rhs);
 }
 
+//
+// TargetResult
+//
+
+bool operator==(const TargetResult &r1, const TargetResult &r2) {
+  return (r1.value == r2.value) && (r1.example == r2.example);
+}
+
+bool operator!=(const TargetResult &r1, const TargetResult &r2) {
+  return !(r1 == r2);
+}
+
+std::ostream &operator<<(std::ostream &os,
+                         const detail::TargetResult &result) {
+  os << "value=" << result.value << ", example=";
+  show(result.example, os);
+  return os;
+}
+
 //
 // SuccessResult
 //
 
 bool operator==(const SuccessResult &r1, const SuccessResult &r2) {
   return (r1.numSuccess == r2.numSuccess) &&
-      (r1.distribution == r2.distribution);
+      (r1.distribution == r2.distribution) && (r1.target == r2.target) &&
+      (r1.complexity == r2.complexity);
 }
 
 bool operator!=(const SuccessResult &r1, const SuccessResult &r2) {
@@ -86,6 +107,12 @@ std::ostream &operator<<(std::ostream &os,
                          const detail::SuccessResult &result) {
   os << "numSuccess=" << result.numSuccess << ", distribution=";
   show(result.distribution, os);
+  if (result.target) {
+    os << ", target={" << *result.target << "}";
+  }
+  if (result.complexity) {
+    os << ", complexity=" << *result.complexity;
+  }
   return os;
 }
 
@@ -122,6 +149,22 @@ void printResultMessage(const SuccessResult &result, std::ostream &os) {
     os << std::endl;
     printDistribution(result, os);
   }
+
+  if (result.target) {
+    os << std::endl;
+    os << "Highest target value " << result.target->value << " reached by:";
+    os << std::endl << std::endl;
+    for (const auto &item : result.target->example) {
+      os << item.first << ":" << std::endl;
+      os << item.second << std::endl;
+      os << std::endl;
+    }
+  }
+
+  if (result.complexity) {
+    os << std::endl;
+    os << "Runtime grows like " << *result.complexity;
+  }
 }
 
 //
@@ -142,7 +185,7 @@ std::ostream &operator<<(std::ostream &os,
                          const detail::FailureResult &result) {
   os << "numSuccess=" << result.numSuccess << ", description='"
      << result.description << "'"
-     << ", reproduce={" << result.reproduce << "}, counterExample=";
+     << ", reproduce=" << result.reproduce << ", counterExample=";
   show(result.counterExample, os);
   return os;
 }
@@ -150,9 +193,9 @@ std::ostream &operator<<(std::ostream &os,
 void printResultMessage(const FailureResult &result, std::ostream &os) {
   os << "Falsifiable after " << (result.numSuccess + 1);
   os << " tests";
-  if (!result.reproduce.shrinkPath.empty()) {
-    os << " and " << result.reproduce.shrinkPath.size() << " shrink";
-    if (result.reproduce.shrinkPath.size() > 1) {
+  if (result.reproduce && !result.reproduce->shrinkPath.empty()) {
+    os << " and " << result.reproduce->shrinkPath.size() << " shrink";
+    if (result.reproduce->shrinkPath.size() > 1) {
       os << 's';
     }
   }
@@ -0,0 +1,60 @@
+#include "rapidcheck/detail/Sampling.h"
+
+#include <cassert>
+#include <numeric>
+#include <unordered_map>
+
+#include "rapidcheck/detail/BoundedRandom.h"
+
+namespace rc {
+namespace detail {
+namespace {
+
+/// Above this ratio of `n` to `k`, the positions are tracked sparsely.
+constexpr std::uint64_t kDenseRatio = 4;
+
+std::vector<std::uint64_t>
+sampleDense(Random &random, std::uint64_t n, std::size_t k) {
+  std::vector<std::uint64_t> values(static_cast<std::size_t>(n));
+  std::iota(begin(values), end(values), std::uint64_t(0));
+  for (std::size_t i = 0; i < k; i++) {
+    const auto j = i + static_cast<std::size_t>(nextBounded(random, n - i));
+    std::swap(values[i], values[j]);
+  }
+  values.resize(k);
+  return values;
+}
+
+std::vector<std::uint64_t>
+sampleSparse(Random &random, std::uint64_t n, std::size_t k) {
+  // Only positions that have been swapped are stored, all others hold their
+  // own index.
+  std::unordered_map<std::uint64_t, std::uint64_t> swapped;
+  swapped.reserve(k * 2);
+  const auto valueAt = [&](std::uint64_t i) {
+    const auto it = swapped.find(i);
+    return (it == end(swapped)) ? i : it->second;
+  };
+
+  std::vector<std::uint64_t> values;
+  values.reserve(k);
+  for (std::size_t i = 0; i < k; i++) {
+    const auto j = i + nextBounded(random, n - i);
+    const auto value = valueAt(j);
+    swapped[j] = valueAt(i);
+    values.push_back(value);
+  }
+  return values;
+}
+
+} // namespace
+
+std::vector<std::uint64_t>
+sampleWithoutReplacement(Random &random, std::uint64_t n, std::size_t k) {
+  assert(k <= n);
+  return ((n / kDenseRatio) <= k) ? sampleDense(random, n, k)
+                                  : sampleSparse(random, n, k);
+}
+
+} // namespace detail
+} // namespace rc
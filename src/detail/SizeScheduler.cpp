@@ -0,0 +1,198 @@
+#include "SizeScheduler.h"
+
+#include <algorithm>
+#include <cmath>
+#include <set>
+#include <vector>
+
+#include "rapidcheck/detail/BoundedRandom.h"
+
+namespace rc {
+namespace detail {
+namespace {
+
+int linearSizeFor(int maxSuccess, int maxSize, int i) {
+  // We want sizes to be evenly spread, even when maxSuccess is not an even
+  // multiple of the number of sizes (i.e. maxSize + 1). Another thing is that
+  // we always want to ensure that the maximum size is actually used.
+
+  const auto numSizes = maxSize + 1;
+  const auto numRegular = (maxSuccess / numSizes) * numSizes;
+  if (i < numRegular) {
+    return i % numSizes;
+  }
+
+  const auto numRest = maxSuccess - numRegular;
+  if (numRest == 1) {
+    return 0;
+  } else {
+    return ((i % numSizes) * maxSize) / (numRest - 1);
+  }
+}
+
+class LinearSizeScheduler : public SizeScheduler {
+public:
+  explicit LinearSizeScheduler(const TestParams &params)
+      : m_params(params) {}
+
+  int nextSize(int numSuccess) override {
+    return linearSizeFor(m_params.maxSuccess, m_params.maxSize, numSuccess);
+  }
+
+  void onCaseFinished(int /*size*/,
+                      const CaseDescription & /*description*/) override {}
+
+private:
+  TestParams m_params;
+};
+
+class ExponentialSizeScheduler : public SizeScheduler {
+public:
+  explicit ExponentialSizeScheduler(const TestParams &params)
+      : m_params(params) {}
+
+  int nextSize(int numSuccess) override {
+    if (m_params.maxSuccess <= 1) {
+      return 0;
+    }
+
+    // Approaches maxSize exponentially, reaching it exactly on the last case.
+    // About half of the cases are run at more than 85% of the maximum size.
+    const auto x =
+        static_cast<double>(numSuccess) / (m_params.maxSuccess - 1);
+    const auto fraction =
+        (1.0 - std::exp(-kRate * x)) / (1.0 - std::exp(-kRate));
+    return static_cast<int>(std::lround(fraction * m_params.maxSize));
+  }
+
+  void onCaseFinished(int /*size*/,
+                      const CaseDescription & /*description*/) override {}
+
+private:
+  static constexpr double kRate = 4.0;
+
+  TestParams m_params;
+};
+
+constexpr double ExponentialSizeScheduler::kRate;
+
+class AdaptiveSizeScheduler : public SizeScheduler {
+public:
+  explicit AdaptiveSizeScheduler(const TestParams &params)
+      : m_params(params)
+      , m_numWarmup(params.maxSuccess / 2)
+      , m_buckets(std::min(params.maxSize + 1, kMaxBuckets))
+      // Decorrelate from the Random used to generate the test cases
+      , m_random(params.seed ^ 0x9E3779B97F4A7C15ULL) {}
+
+  int nextSize(int numSuccess) override {
+    // Sweep all sizes once to gather statistics
+    if (numSuccess < m_numWarmup) {
+      return linearSizeFor(m_numWarmup, m_params.maxSize, numSuccess);
+    }
+
+    // Like the other schedules, always make sure that the maximum size is used
+    if ((numSuccess == (m_params.maxSuccess - 1)) && (numSuccess > 0)) {
+      return m_params.maxSize;
+    }
+
+    std::vector<double> weights;
+    weights.reserve(m_buckets.size());
+    double total = 0.0;
+    for (const auto &bucket : m_buckets) {
+      total += bucket.weight();
+      weights.push_back(total);
+    }
+
+    const auto x = (static_cast<double>(m_random.next() >> 11) /
+                    static_cast<double>(1ULL << 53)) *
+        total;
+    const auto it = std::upper_bound(begin(weights), end(weights), x);
+    const auto i = std::min(static_cast<std::size_t>(it - begin(weights)),
+                            m_buckets.size() - 1);
+
+    const auto first = bucketStart(i);
+    const auto span = bucketStart(i + 1) - first;
+    return first + static_cast<int>(nextBounded(m_random, span));
+  }
+
+  void onCaseFinished(int size, const CaseDescription &description) override {
+    auto &bucket = m_buckets[bucketFor(size)];
+    bucket.numCases++;
+    switch (description.result.type) {
+    case CaseResult::Type::Success:
+      if (!description.tags.empty() &&
+          m_seenTags.insert(description.tags).second) {
+        bucket.numNewTags++;
+      }
+      break;
+
+    case CaseResult::Type::Discard:
+      bucket.numDiscards++;
+      break;
+
+    case CaseResult::Type::Failure:
+      break;
+    }
+  }
+
+private:
+  static constexpr int kMaxBuckets = 10;
+
+  struct Bucket {
+    int numCases = 0;
+    int numDiscards = 0;
+    int numNewTags = 0;
+
+    double weight() const {
+      // Fraction of cases that were not discarded, smoothed so that sizes we
+      // know little about still get a chance
+      const auto yield = static_cast<double>(numCases - numDiscards + 1) /
+          static_cast<double>(numCases + 2);
+      // Sizes that keep finding new tags are likely to reach new behavior
+      const auto novelty = static_cast<double>(numNewTags + 1) /
+          static_cast<double>(numCases + 1);
+      return yield * (1.0 + 10.0 * novelty);
+    }
+  };
+
+  int bucketStart(std::size_t i) const {
+    // Rounded up so that it agrees with bucketFor
+    const auto numSizes = static_cast<std::size_t>(m_params.maxSize) + 1;
+    return static_cast<int>((i * numSizes + m_buckets.size() - 1) /
+                            m_buckets.size());
+  }
+
+  std::size_t bucketFor(int size) const {
+    const auto clamped = std::max(0, std::min(size, m_params.maxSize));
+    return (static_cast<std::size_t>(clamped) * m_buckets.size()) /
+        (m_params.maxSize + 1);
+  }
+
+  TestParams m_params;
+  int m_numWarmup;
+  std::vector<Bucket> m_buckets;
+  std::set<Tags> m_seenTags;
+  Random m_random;
+};
+
+constexpr int AdaptiveSizeScheduler::kMaxBuckets;
+
+} // namespace
+
+std::unique_ptr<SizeScheduler> makeSizeScheduler(const TestParams &params) {
+  switch (params.sizeSchedule) {
+  case SizeSchedule::Exponential:
+    return std::unique_ptr<SizeScheduler>(
+        new ExponentialSizeScheduler(params));
+  case SizeSchedule::Adaptive:
+    return std::unique_ptr<SizeScheduler>(new AdaptiveSizeScheduler(params));
+  case SizeSchedule::Linear:
+    break;
+  }
+
+  return std::unique_ptr<SizeScheduler>(new LinearSizeScheduler(params));
+}
+
+} // namespace detail
+} // namespace rc
@@ -0,0 +1,33 @@
+#pragma once
+
+#include <memory>
+
+#include "rapidcheck/detail/Property.h"
+#include "rapidcheck/detail/TestParams.h"
+
+namespace rc {
+namespace detail {
+
+/// Decides the size of each test case run by `searchProperty`.
+class SizeScheduler {
+public:
+  /// Returns the size to use for the next test case.
+  ///
+  /// @param numSuccess  The number of successful test cases so far.
+  virtual int nextSize(int numSuccess) = 0;
+
+  /// Called with the outcome of each test case so that the schedule can adapt
+  /// to it.
+  ///
+  /// @param size         The size the case was generated with.
+  /// @param description  The description of the case.
+  virtual void onCaseFinished(int size, const CaseDescription &description) = 0;
+
+  virtual ~SizeScheduler() = default;
+};
+
+/// Creates a `SizeScheduler` for the schedule selected in the given params.
+std::unique_ptr<SizeScheduler> makeSizeScheduler(const TestParams &params);
+
+} // namespace detail
+} // namespace rc
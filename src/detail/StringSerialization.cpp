@@ -5,10 +5,19 @@
 
 namespace rc {
 namespace detail {
+namespace {
+
+// Reproduce maps start with a zero byte followed by the version of the format.
+// Maps from before the version was added start with the number of properties
+// instead which is never zero for a map that was printed.
+constexpr std::uint8_t kFormatMarker = 0;
+constexpr std::uint8_t kFormatVersion = 1;
+
+} // namespace
 
 std::string reproduceMapToString(
     const std::unordered_map<std::string, Reproduce> &reproduceMap) {
-  std::vector<std::uint8_t> data;
+  std::vector<std::uint8_t> data{kFormatMarker, kFormatVersion};
   serialize(reproduceMap, std::back_inserter(data));
   return base64Encode(data);
 }
@@ -16,9 +25,16 @@ std::string reproduceMapToString(
 std::unordered_map<std::string, Reproduce>
 stringToReproduceMap(const std::string &str) {
   const auto data = base64Decode(str);
+  if ((data.size() < 2) || (data[0] != kFormatMarker)) {
+    throw ParseException(
+        0, "String was printed by an older version of RapidCheck");
+  } else if (data[1] != kFormatVersion) {
+    throw ParseException(0, "Unsupported format version");
+  }
+
   std::unordered_map<std::string, Reproduce> reproduceMap;
   try {
-    deserialize(begin(data), end(data), reproduceMap);
+    deserialize(begin(data) + 2, end(data), reproduceMap);
   } catch (const SerializationException &) {
     throw ParseException(0, "Invalid format");
   }
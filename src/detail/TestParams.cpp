@@ -1,16 +1,107 @@
 #include "rapidcheck/detail/TestParams.h"
 
+#include <iostream>
+#include <string>
+
 #include "rapidcheck/detail/ImplicitParam.h"
 #include "rapidcheck/detail/Configuration.h"
 
 namespace rc {
 namespace detail {
 
+std::ostream &operator<<(std::ostream &os, SizeSchedule schedule) {
+  switch (schedule) {
+  case SizeSchedule::Linear:
+    os << "linear";
+    break;
+  case SizeSchedule::Exponential:
+    os << "exponential";
+    break;
+  case SizeSchedule::Adaptive:
+    os << "adaptive";
+    break;
+  }
+  return os;
+}
+
+std::istream &operator>>(std::istream &is, SizeSchedule &schedule) {
+  std::string str;
+  is >> str;
+  if (str == "linear") {
+    schedule = SizeSchedule::Linear;
+  } else if (str == "exponential") {
+    schedule = SizeSchedule::Exponential;
+  } else if (str == "adaptive") {
+    schedule = SizeSchedule::Adaptive;
+  } else {
+    is.setstate(std::ios::failbit);
+  }
+  return is;
+}
+
+std::ostream &operator<<(std::ostream &os, ShrinkEngine engine) {
+  switch (engine) {
+  case ShrinkEngine::Tree:
+    os << "tree";
+    break;
+  case ShrinkEngine::Choices:
+    os << "choices";
+    break;
+  }
+  return os;
+}
+
+std::istream &operator>>(std::istream &is, ShrinkEngine &engine) {
+  std::string str;
+  is >> str;
+  if (str == "tree") {
+    engine = ShrinkEngine::Tree;
+  } else if (str == "choices") {
+    engine = ShrinkEngine::Choices;
+  } else {
+    is.setstate(std::ios::failbit);
+  }
+  return is;
+}
+
+std::ostream &operator<<(std::ostream &os, CaseIsolation isolation) {
+  switch (isolation) {
+  case CaseIsolation::None:
+    os << "none";
+    break;
+  case CaseIsolation::Fork:
+    os << "fork";
+    break;
+  }
+  return os;
+}
+
+std::istream &operator>>(std::istream &is, CaseIsolation &isolation) {
+  std::string str;
+  is >> str;
+  if (str == "none") {
+    isolation = CaseIsolation::None;
+  } else if (str == "fork") {
+    isolation = CaseIsolation::Fork;
+  } else {
+    is.setstate(std::ios::failbit);
+  }
+  return is;
+}
+
 bool operator==(const TestParams &p1, const TestParams &p2) {
   return (p1.seed == p2.seed) && (p1.maxSuccess == p2.maxSuccess) &&
       (p1.maxSize == p2.maxSize) &&
       (p1.maxDiscardRatio == p2.maxDiscardRatio) &&
-      (p1.disableShrinking == p2.disableShrinking);
+      (p1.disableShrinking == p2.disableShrinking) &&
+      (p1.shrinkEngine == p2.shrinkEngine) &&
+      (p1.sizeSchedule == p2.sizeSchedule) &&
+      (p1.coverageGuided == p2.coverageGuided) &&
+      (p1.failFast == p2.failFast) &&
+      (p1.shardIndex == p2.shardIndex) && (p1.shardCount == p2.shardCount) &&
+      (p1.caseTimeoutMs == p2.caseTimeoutMs) &&
+      (p1.isolation == p2.isolation) &&
+      (p1.memoryLimitMb == p2.memoryLimitMb);
 }
 
 bool operator!=(const TestParams &p1, const TestParams &p2) {
@@ -21,7 +112,16 @@ std::ostream &operator<<(std::ostream &os, const TestParams &params) {
   os << "seed=" << params.seed << ", maxSuccess=" << params.maxSuccess
      << ", maxSize=" << params.maxSize
      << ", maxDiscardRatio=" << params.maxDiscardRatio
-     << ", disableShrinking=" << params.disableShrinking;
+     << ", disableShrinking=" << params.disableShrinking
+     << ", shrinkEngine=" << params.shrinkEngine
+     << ", sizeSchedule=" << params.sizeSchedule
+     << ", coverageGuided=" << params.coverageGuided
+     << ", failFast=" << params.failFast
+     << ", shardIndex=" << params.shardIndex
+     << ", shardCount=" << params.shardCount
+     << ", caseTimeoutMs=" << params.caseTimeoutMs
+     << ", isolation=" << params.isolation
+     << ", memoryLimitMb=" << params.memoryLimitMb;
   return os;
 }
 
@@ -1,31 +1,271 @@
 #include "Testing.h"
 
+#include <algorithm>
+#include <atomic>
+#include <cmath>
+#include <cstdlib>
+#include <iostream>
+#include <sstream>
+
 #include "rapidcheck/BeforeMinimalTestCase.h"
+#include "rapidcheck/shrinkable/Create.h"
 #include "rapidcheck/shrinkable/Operations.h"
 
+#include "rapidcheck/detail/BoundedRandom.h"
+
+#include "ChoiceShrinking.h"
+#include "ComplexityFit.h"
+#include "Coverage.h"
+#include "Isolation.h"
+#include "SizeScheduler.h"
+#include "StringSerialization.h"
+#include "Watchdog.h"
+
 namespace rc {
 namespace detail {
 namespace {
 
-int sizeFor(const TestParams &params, int i) {
-  // We want sizes to be evenly spread, even when maxSuccess is not an even
-  // multiple of the number of sizes (i.e. maxSize + 1). Another thing is that
-  // we always want to ensure that the maximum size is actually used.
+std::atomic<bool> testingCancelled(false);
 
-  const auto numSizes = params.maxSize + 1;
-  const auto numRegular = (params.maxSuccess / numSizes) * numSizes;
-  if (i < numRegular) {
-    return i % numSizes;
-  }
+} // namespace
 
-  const auto numRest = params.maxSuccess - numRegular;
-  if (numRest == 1) {
-    return 0;
-  } else {
-    return ((i % numSizes) * params.maxSize) / (numRest - 1);
+void setTestingCancelled(bool cancelled) { testingCancelled = cancelled; }
+
+bool isTestingCancelled() { return testingCancelled; }
+
+CaseDescription runWithChoices(const Property &property,
+                               const Random &random,
+                               int size,
+                               ChoiceSource &source) {
+  ChoiceSourceScope scope(source);
+  auto caseDescription = property(random, size).value();
+  // The example is lazily computed from the generated values so it must be
+  // computed while the choices are being replayed
+  const auto example = caseDescription.example();
+  caseDescription.example = [=] { return example; };
+  return caseDescription;
+}
+
+namespace {
+
+void skipSplits(Random &random, int n) {
+  for (int i = 0; i < n; i++) {
+    random.split();
   }
 }
 
+Shrinkable<CaseDescription> replayChoices(const Property &property,
+                                          const Random &random,
+                                          int size,
+                                          Choices choices) {
+  return shrinkable::lambda([=] {
+    ChoiceSource source(choices);
+    return runWithChoices(property, random, size, source);
+  });
+}
+
+struct TestCase {
+  TestCase(Shrinkable<CaseDescription> shr, CaseDescription desc, int sz)
+      : shrinkable(std::move(shr))
+      , description(std::move(desc))
+      , size(sz) {}
+
+  Shrinkable<CaseDescription> shrinkable;
+  CaseDescription description;
+  int size;
+  /// Set if the test case was produced by mutation and can thus only be
+  /// replayed from its choices.
+  Maybe<Choices> choices;
+};
+
+/// Runs test cases and, if coverage guidance is enabled, keeps the choices of
+/// the ones that reach new coverage in a corpus that about half of the
+/// following test cases are mutated from.
+class CoverageGuidance {
+public:
+  explicit CoverageGuidance(const TestParams &params)
+      : m_enabled(params.coverageGuided && m_coverage.enabled())
+      // Mutations use their own Random so that the test cases that are not
+      // mutated are the same as without coverage guidance
+      , m_random(~params.seed) {}
+
+  TestCase run(const Property &property, const Random &random, int size) {
+    if (!m_enabled) {
+      auto shrinkable = property(random, size);
+      auto description = shrinkable.value();
+      return TestCase(std::move(shrinkable), std::move(description), size);
+    }
+
+    ChoiceSource source;
+    const auto mutated = !m_corpus.empty() && (nextBounded(m_random, 2) == 0);
+    if (mutated) {
+      auto entry = m_corpus.mutate(m_random);
+      source = ChoiceSource(std::move(entry.choices));
+      size = entry.size;
+    }
+
+    m_coverage.beginCase();
+    auto testCase = [&] {
+      if (mutated) {
+        auto description = runWithChoices(property, random, size, source);
+        return TestCase(
+            replayChoices(property, random, size, source.choices()),
+            std::move(description),
+            size);
+      }
+
+      ChoiceSourceScope scope(source);
+      auto shrinkable = property(random, size);
+      auto description = shrinkable.value();
+      return TestCase(std::move(shrinkable), std::move(description), size);
+    }();
+    if (m_coverage.endCase()) {
+      m_corpus.add(source.choices(), size);
+    }
+
+    if (mutated) {
+      testCase.choices = source.choices();
+    }
+    return testCase;
+  }
+
+private:
+  CoverageTracker m_coverage;
+  CoverageCorpus m_corpus;
+  bool m_enabled;
+  Random m_random;
+};
+
+/// Searches for the test case with the highest value reported using
+/// `RC_TARGET` by hill climbing. Once half of the test cases have been run,
+/// about three quarters of the remaining ones are neighbors of the best test
+/// case so far, produced by mutating its choices. Most neighbors nudge a single
+/// choice up or down and a nudge that leads to a higher value is tried again
+/// with twice the step. A neighbor replaces the best test case if its value is
+/// at least as high so that plateaus can be crossed. The rest are ordinary test
+/// cases so that the search is not confined to a single local maximum.
+class TargetedSearch {
+public:
+  TargetedSearch(const TestParams &params, int maxSuccess)
+      : m_climbFrom(maxSuccess / 2)
+      , m_random(Random(~params.seed).split()) {}
+
+  /// Returns `true` if the next test case should be a neighbor of the best
+  /// test case.
+  bool shouldClimb(int numSuccess) {
+    m_triedNudge.reset();
+    return m_best && (numSuccess >= m_climbFrom) &&
+        (nextBounded(m_random, 4) != 0);
+  }
+
+  /// Runs a neighbor of the best test case.
+  TestCase climb(const Property &property, const Random &random) {
+    auto choices = m_best->choices;
+    if (m_nudge) {
+      m_triedNudge = *m_nudge;
+      m_triedNudge->step *= 2;
+      m_nudge.reset();
+    } else if (!choices.empty() && (nextBounded(m_random, 4) != 0)) {
+      m_triedNudge.init();
+      m_triedNudge->index = nextBounded(m_random, choices.size());
+      // Generators mostly use the high bits so steps of every magnitude are
+      // needed
+      m_triedNudge->step = (1 + nextBounded(m_random, 16))
+          << nextBounded(m_random, 60);
+      m_triedNudge->up = nextBounded(m_random, 2) == 0;
+    }
+
+    if (m_triedNudge) {
+      auto &choice = choices[m_triedNudge->index];
+      const auto step = m_triedNudge->step;
+      if (m_triedNudge->up) {
+        choice = (choice > (~Random::Number(0) - step)) ? ~Random::Number(0)
+                                                         : (choice + step);
+      } else {
+        choice = (choice < step) ? 0 : (choice - step);
+      }
+    } else {
+      mutateChoices(choices, m_random);
+    }
+
+    ChoiceSource source(std::move(choices));
+    const auto size = m_best->size;
+    auto description = runWithChoices(property, random, size, source);
+    TestCase testCase(replayChoices(property, random, size, source.choices()),
+                      std::move(description),
+                      size);
+    testCase.choices = source.choices();
+    return testCase;
+  }
+
+  /// Call when a test case has succeeded.
+  void onSuccess(const Property &property,
+                 const Random &random,
+                 const TestCase &testCase) {
+    const auto &target = testCase.description.target;
+    if (!target || std::isnan(*target) ||
+        (m_best && (*target < m_best->value))) {
+      return;
+    }
+
+    if (m_best && (*target == m_best->value)) {
+      // Only neighbors cross plateaus
+      if (!testCase.choices) {
+        return;
+      }
+    } else {
+      // Keep going in the same direction
+      m_nudge = m_triedNudge;
+    }
+
+    // Run the test case again to record its choices and its example since the
+    // example may need the choices to be computed
+    ChoiceSource source;
+    if (testCase.choices) {
+      source = ChoiceSource(*testCase.choices);
+    }
+    auto description = runWithChoices(property, random, testCase.size, source);
+
+    m_best.init();
+    m_best->value = *target;
+    m_best->example = description.example();
+    m_best->choices = source.choices();
+    m_best->size = testCase.size;
+  }
+
+  /// Returns the best target reached, if any.
+  Maybe<TargetResult> result() const {
+    if (!m_best) {
+      return Nothing;
+    }
+
+    TargetResult result;
+    result.value = m_best->value;
+    result.example = m_best->example;
+    return result;
+  }
+
+private:
+  struct Best {
+    double value;
+    Example example;
+    Choices choices;
+    int size;
+  };
+
+  struct Nudge {
+    std::size_t index;
+    Random::Number step;
+    bool up;
+  };
+
+  int m_climbFrom;
+  Random m_random;
+  Maybe<Best> m_best;
+  Maybe<Nudge> m_nudge;
+  Maybe<Nudge> m_triedNudge;
+};
+
 } // namespace
 
 SearchResult searchProperty(const Property &property,
@@ -35,27 +275,52 @@ SearchResult searchProperty(const Property &property,
   searchResult.type = SearchResult::Type::Success;
   searchResult.numSuccess = 0;
   searchResult.numDiscarded = 0;
-  searchResult.tags.reserve(params.maxSuccess);
 
-  const auto maxDiscard = params.maxDiscardRatio * params.maxSuccess;
+  // When sharding, this shard runs the test cases of every shardCount:th split
+  // of the Random starting at shardIndex so no two shards share a split. The
+  // sizes only match those of the unsharded run as long as nothing is
+  // discarded since discards delay the size schedule of the shard that saw
+  // them.
+  const auto shardCount = std::max(params.shardCount, 1);
+  const auto shardIndex = params.shardIndex;
+  const auto maxSuccess = (params.maxSuccess / shardCount) +
+      ((shardIndex < (params.maxSuccess % shardCount)) ? 1 : 0);
+  searchResult.tags.reserve(maxSuccess);
 
+  const auto maxDiscard = params.maxDiscardRatio * maxSuccess;
+
+  const auto scheduler = makeSizeScheduler(params);
+  CoverageGuidance guidance(params);
+  TargetedSearch targeting(params, maxSuccess);
   auto recentDiscards = 0;
+  auto largestComplexityN = 0.0;
   auto r = Random(params.seed);
-  while (searchResult.numSuccess < params.maxSuccess) {
-    const auto size =
-        sizeFor(params, searchResult.numSuccess) + (recentDiscards / 10);
+  skipSplits(r, shardIndex);
+  while (searchResult.numSuccess < maxSuccess) {
+    if (params.failFast && isTestingCancelled()) {
+      searchResult.type = SearchResult::Type::Cancelled;
+      return searchResult;
+    }
+
+    const auto caseIndex = (searchResult.numSuccess * shardCount) + shardIndex;
+    const auto size = scheduler->nextSize(caseIndex) + (recentDiscards / 10);
     const auto random = r.split();
+    skipSplits(r, shardCount - 1);
 
-    auto shrinkable = property(random, size);
-    auto caseDescription = shrinkable.value();
+    auto testCase = targeting.shouldClimb(searchResult.numSuccess)
+        ? targeting.climb(property, random)
+        : guidance.run(property, random, size);
+    auto &caseDescription = testCase.description;
     listener.onTestCaseFinished(caseDescription);
+    scheduler->onCaseFinished(testCase.size, caseDescription);
     const auto &result = caseDescription.result;
 
     switch (result.type) {
     case CaseResult::Type::Failure:
       searchResult.type = SearchResult::Type::Failure;
-      searchResult.failure =
-          SearchResult::Failure(std::move(shrinkable), size, random);
+      searchResult.failure = SearchResult::Failure(
+          std::move(testCase.shrinkable), testCase.size, random);
+      searchResult.failure->choices = std::move(testCase.choices);
       return searchResult;
 
     case CaseResult::Type::Discard:
@@ -63,8 +328,9 @@ SearchResult searchProperty(const Property &property,
       recentDiscards++;
       if (searchResult.numDiscarded > maxDiscard) {
         searchResult.type = SearchResult::Type::GaveUp;
-        searchResult.failure =
-            SearchResult::Failure(std::move(shrinkable), size, random);
+        searchResult.failure = SearchResult::Failure(
+            std::move(testCase.shrinkable), testCase.size, random);
+        searchResult.failure->choices = std::move(testCase.choices);
         return searchResult;
       }
       break;
@@ -72,6 +338,15 @@ SearchResult searchProperty(const Property &property,
     case CaseResult::Type::Success:
       searchResult.numSuccess++;
       recentDiscards = 0;
+      targeting.onSuccess(property, random, testCase);
+      if (const auto &sample = caseDescription.complexity) {
+        if (searchResult.complexitySamples.empty() ||
+            (sample->n >= largestComplexityN)) {
+          largestComplexityN = sample->n;
+          searchResult.largestComplexityExample = caseDescription.example();
+        }
+        searchResult.complexitySamples.push_back(*sample);
+      }
       if (!caseDescription.tags.empty()) {
         searchResult.tags.push_back(std::move(caseDescription.tags));
       }
@@ -79,6 +354,7 @@ SearchResult searchProperty(const Property &property,
     }
   }
 
+  searchResult.target = targeting.result();
   return searchResult;
 }
 
@@ -107,6 +383,51 @@ shrinkTestCase(const Shrinkable<CaseDescription> &shrinkable,
   return std::make_pair(std::move(best), std::move(path));
 }
 
+std::pair<Shrinkable<CaseDescription>, Choices>
+shrinkTestCaseChoices(const Property &property,
+                      const Random &random,
+                      int size,
+                      TestListener &listener) {
+  ChoiceSource recorder;
+  {
+    ChoiceSourceScope scope(recorder);
+    property(random, size).value();
+  }
+
+  return shrinkTestCaseChoices(
+      property, random, size, recorder.choices(), listener);
+}
+
+std::pair<Shrinkable<CaseDescription>, Choices>
+shrinkTestCaseChoices(const Property &property,
+                      const Random &random,
+                      int size,
+                      const Choices &choices,
+                      TestListener &listener) {
+  auto shrunk =
+      shrinkChoices(choices,
+                    [&](Choices &candidate) {
+                      ChoiceSource source(candidate);
+                      CaseDescription caseDescription;
+                      {
+                        ChoiceSourceScope scope(source);
+                        caseDescription = property(random, size).value();
+                      }
+
+                      const auto accept = !source.overrun() &&
+                          (caseDescription.result.type ==
+                           CaseResult::Type::Failure);
+                      listener.onShrinkTried(caseDescription, accept);
+                      if (accept) {
+                        candidate.resize(source.numUsed());
+                      }
+                      return accept;
+                    });
+
+  auto shrinkable = replayChoices(property, random, size, shrunk);
+  return std::make_pair(std::move(shrinkable), std::move(shrunk));
+}
+
 namespace {
 
 TestResult doTestProperty(const Property &property,
@@ -119,51 +440,161 @@ TestResult doTestProperty(const Property &property,
     for (const auto &tags : searchResult.tags) {
       success.distribution[tags]++;
     }
-    return success;
+    success.target = searchResult.target;
+    success.complexity = fitComplexity(searchResult.complexitySamples);
+
+    // Use the strictest bound if there are several
+    Maybe<Complexity> bound;
+    for (const auto &sample : searchResult.complexitySamples) {
+      if (sample.bound && (!bound || (*sample.bound < *bound))) {
+        bound = sample.bound;
+      }
+    }
+
+    if (!success.complexity || !bound || (*success.complexity <= *bound)) {
+      return success;
+    }
+
+    // The largest input is the most representative example of the growth
+    std::ostringstream ss;
+    ss << "Runtime grows like " << *success.complexity << " but the bound is "
+       << *bound;
+    FailureResult failure;
+    failure.numSuccess = searchResult.numSuccess;
+    failure.description = ss.str();
+    // No single test case fails so there is nothing to reproduce
+    failure.counterExample = searchResult.largestComplexityExample;
+    return failure;
   } else if (searchResult.type == SearchResult::Type::GaveUp) {
     GaveUpResult gaveUp;
     gaveUp.numSuccess = searchResult.numSuccess;
     const auto &shrinkable = searchResult.failure->shrinkable;
     gaveUp.description = shrinkable.value().result.description;
     return gaveUp;
+  } else if (searchResult.type == SearchResult::Type::Cancelled) {
+    return Error("Cancelled after " + std::to_string(searchResult.numSuccess) +
+                 " tests since another property failed (fail_fast=1)");
   } else {
-    // Shrink it unless shrinking is disabled
-    const auto &shrinkable = searchResult.failure->shrinkable;
-    auto shrinkResult = params.disableShrinking
-        ? std::make_pair(shrinkable, std::vector<std::size_t>())
-        : shrinkTestCase(shrinkable, listener);
+    // Shrink it unless shrinking is disabled. Failures found by mutation can
+    // only be replayed from their choices so those are always shrunk by
+    // shrinking choices.
+    const auto &searchFailure = *searchResult.failure;
+    auto shrunk = searchFailure.shrinkable;
+    Reproduce reproduce;
+    reproduce.random = searchFailure.random;
+    reproduce.size = searchFailure.size;
+    if (params.disableShrinking) {
+      // Keep the unshrunk test case, which can only be replayed from its
+      // choices if it was produced by mutation
+      if (searchFailure.choices) {
+        reproduce.choices = *searchFailure.choices;
+      }
+    } else if (searchFailure.choices) {
+      auto shrinkResult = shrinkTestCaseChoices(property,
+                                                searchFailure.random,
+                                                searchFailure.size,
+                                                *searchFailure.choices,
+                                                listener);
+      shrunk = std::move(shrinkResult.first);
+      reproduce.choices = std::move(shrinkResult.second);
+    } else if ((params.shrinkEngine == ShrinkEngine::Choices) ||
+               (params.isolation == CaseIsolation::Fork)) {
+      // Isolated test cases have no shrinks, only their choices can be shrunk
+      auto shrinkResult = shrinkTestCaseChoices(
+          property, searchFailure.random, searchFailure.size, listener);
+      shrunk = std::move(shrinkResult.first);
+      reproduce.choices = std::move(shrinkResult.second);
+    } else {
+      auto shrinkResult = shrinkTestCase(shrunk, listener);
+      shrunk = std::move(shrinkResult.first);
+      reproduce.shrinkPath = std::move(shrinkResult.second);
+    }
 
     // Give the developer a chance to set a breakpoint before the final minimal
     // test case is run
     beforeMinimalTestCase();
     // ...and here we actually run it
-    const auto caseDescription = shrinkResult.first.value();
+    const auto caseDescription = shrunk.value();
 
     FailureResult failure;
     failure.numSuccess = searchResult.numSuccess;
     failure.description = std::move(caseDescription.result.description);
-    failure.reproduce.random = searchResult.failure->random;
-    failure.reproduce.size = searchResult.failure->size;
-    failure.reproduce.shrinkPath = std::move(shrinkResult.second);
+    failure.reproduce = std::move(reproduce);
     failure.counterExample = caseDescription.example();
     return failure;
   }
 }
 
+/// A test case that runs in the testing process cannot be stopped so a timeout
+/// is reported and the process is terminated.
+void abortTimedOutCase(const TestMetadata &metadata,
+                       const TestParams &params,
+                       const Maybe<Reproduce> &reproduce) {
+  std::cerr << std::endl << "Test case timed out after "
+            << params.caseTimeoutMs << " ms";
+  if (!metadata.description.empty()) {
+    std::cerr << " in property '" << metadata.description << "'";
+  }
+  std::cerr << ". Test cases cannot be stopped unless they are isolated "
+            << "(isolation=fork) so testing is aborted." << std::endl;
+
+  if (reproduce && !metadata.id.empty()) {
+    std::unordered_map<std::string, Reproduce> reproduceMap;
+    reproduceMap.emplace(metadata.id, *reproduce);
+    std::cerr << "To reproduce it, run with:" << std::endl
+              << "RC_PARAMS=\"reproduce=" << reproduceMapToString(reproduceMap)
+              << "\"" << std::endl;
+  }
+
+  std::_Exit(EXIT_FAILURE);
+}
+
+/// Runs `doTestProperty` with test cases that are isolated or watched for
+/// timeouts as configured.
+TestResult superviseTestProperty(const Property &property,
+                                 const TestMetadata &metadata,
+                                 const TestParams &params,
+                                 TestListener &listener) {
+  if (!watchesTestCases(params)) {
+    return doTestProperty(
+        isolateProperty(property, params), params, listener);
+  }
+
+  Watchdog watchdog(std::chrono::milliseconds(params.caseTimeoutMs));
+  const auto watched = watchProperty(
+      property, watchdog, [&](const Maybe<Reproduce> &reproduce) {
+        abortTimedOutCase(metadata, params, reproduce);
+      });
+  return doTestProperty(watched, params, listener);
+}
+
 } // namespace
 
+bool watchesTestCases(const TestParams &params) {
+  return (params.caseTimeoutMs != 0) &&
+      ((params.isolation == CaseIsolation::None) || !isolationAvailable());
+}
+
 TestResult testProperty(const Property &property,
                         const TestMetadata &metadata,
                         const TestParams &params,
                         TestListener &listener) {
-  TestResult result = doTestProperty(property, params, listener);
+  TestResult result =
+      superviseTestProperty(property, metadata, params, listener);
+  if (params.failFast && !result.is<SuccessResult>()) {
+    setTestingCancelled(true);
+  }
   listener.onTestFinished(metadata, result);
   return result;
 }
 
 TestResult reproduceProperty(const Property &property,
                              const Reproduce &reproduce) {
-  const auto shrinkable = property(reproduce.random, reproduce.size);
+  // Failures shrunk by their choices are replayed from those instead
+  const auto shrinkable = reproduce.choices.empty()
+      ? property(reproduce.random, reproduce.size)
+      : replayChoices(
+            property, reproduce.random, reproduce.size, reproduce.choices);
   const auto minShrinkable =
       shrinkable::walkPath(shrinkable, reproduce.shrinkPath);
   if (!minShrinkable) {
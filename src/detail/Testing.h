@@ -9,11 +9,13 @@
 #include "rapidcheck/detail/TestParams.h"
 #include "rapidcheck/detail/TestListener.h"
 
+#include "ChoiceSource.h"
+
 namespace rc {
 namespace detail {
 
 struct SearchResult {
-  enum class Type { Success, Failure, GaveUp };
+  enum class Type { Success, Failure, GaveUp, Cancelled };
 
   /// Represents information about a failure.
   struct Failure {
@@ -30,6 +32,11 @@ struct SearchResult {
 
     /// The Random state which produced the failure.
     Random random;
+
+    /// Set if the failure was found by mutating the choices of another test
+    /// case when using coverage guidance. Such failures can only be replayed
+    /// from these choices.
+    Maybe<Choices> choices;
   };
 
   /// The type of the result.
@@ -46,8 +53,34 @@ struct SearchResult {
 
   /// On Failure or GiveUp, contains failure information.
   Maybe<Failure> failure;
+
+  /// On Success, the highest value reported using `RC_TARGET`, if any.
+  Maybe<TargetResult> target;
+
+  /// The measurements made using `RC_COMPLEXITY` by successful test cases.
+  std::vector<ComplexitySample> complexitySamples;
+
+  /// The example of the successful test case with the largest input size
+  /// measured using `RC_COMPLEXITY`, captured when it was run.
+  Example largestComplexityExample;
 };
 
+/// Sets whether testing has been cancelled. While cancelled, searches with
+/// `TestParams::failFast` enabled stop before running their next test case.
+/// This is safe to call from any thread.
+void setTestingCancelled(bool cancelled);
+
+/// Returns `true` if testing has been cancelled.
+bool isTestingCancelled();
+
+/// Runs a single test case of the given property with `source` installed and
+/// returns its description with the example already computed so that it can be
+/// used once the source is no longer installed.
+CaseDescription runWithChoices(const Property &property,
+                               const Random &random,
+                               int size,
+                               ChoiceSource &source);
+
 /// Searches for a failure in the given property.
 ///
 /// @param property  The property to search.
@@ -69,6 +102,37 @@ std::pair<Shrinkable<CaseDescription>, std::vector<std::size_t>>
 shrinkTestCase(const Shrinkable<CaseDescription> &shrinkable,
                TestListener &listener);
 
+/// Shrinks a failing test case by recording the values drawn from `Random`
+/// while generating it and shrinking those instead, see `shrinkChoices`.
+///
+/// @param property  The property that failed.
+/// @param random    The `Random` that produced the failure.
+/// @param size      The size that produced the failure.
+/// @param listener  A test listener to report progress to.
+///
+/// @return A pair of the final shrink and the choices that it replays since
+///         it cannot be reached through the shrinks of the original test case.
+std::pair<Shrinkable<CaseDescription>, Choices>
+shrinkTestCaseChoices(const Property &property,
+                      const Random &random,
+                      int size,
+                      TestListener &listener);
+
+/// Like `shrinkTestCaseChoices` above but starts from the given choices instead
+/// of recording those of the test case generated by `random` and `size`.
+std::pair<Shrinkable<CaseDescription>, Choices>
+shrinkTestCaseChoices(const Property &property,
+                      const Random &random,
+                      int size,
+                      const Choices &choices,
+                      TestListener &listener);
+
+/// Returns `true` if the test cases run by `testProperty` with the given
+/// parameters are watched for timeouts in the testing process, which is the
+/// case when a timeout is set and test cases are not isolated, either because
+/// isolation is not requested or because it is not available.
+bool watchesTestCases(const TestParams &params);
+
 /// Combined search and shrink. Returns a test result.
 ///
 /// @param property  The property to test.
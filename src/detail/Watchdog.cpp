@@ -0,0 +1,151 @@
+#include "Watchdog.h"
+
+#include "rapidcheck/seq/Create.h"
+#include "rapidcheck/seq/Transform.h"
+
+#include "ChoiceSource.h"
+
+namespace rc {
+namespace detail {
+
+Watchdog::Watchdog(std::chrono::milliseconds timeout)
+    : m_timeout(timeout)
+    , m_watching(false)
+    , m_idle(true)
+    , m_quit(false)
+    , m_thread([this] { run(); }) {}
+
+Watchdog::~Watchdog() {
+  {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    m_quit = true;
+  }
+  m_condition.notify_one();
+  m_thread.join();
+}
+
+void Watchdog::start(std::function<void()> onTimeout) {
+  bool wasIdle;
+  {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    m_onTimeout = std::move(onTimeout);
+    m_deadline = std::chrono::steady_clock::now() + m_timeout;
+    m_watching = true;
+    wasIdle = m_idle;
+    m_idle = false;
+  }
+
+  // Deadlines only move forward so if the thread is already waiting for an
+  // earlier one, it will notice the new one when it wakes up. This keeps the
+  // cost of watching a test case low.
+  if (wasIdle) {
+    m_condition.notify_one();
+  }
+}
+
+void Watchdog::stop() {
+  std::lock_guard<std::mutex> lock(m_mutex);
+  m_watching = false;
+  m_onTimeout = nullptr;
+}
+
+void Watchdog::run() {
+  std::unique_lock<std::mutex> lock(m_mutex);
+  while (!m_quit) {
+    if (!m_watching) {
+      m_idle = true;
+      m_condition.wait(lock);
+    } else if (std::chrono::steady_clock::now() < m_deadline) {
+      m_condition.wait_until(lock, m_deadline);
+    } else {
+      auto onTimeout = std::move(m_onTimeout);
+      m_watching = false;
+      lock.unlock();
+      onTimeout();
+      lock.lock();
+    }
+  }
+}
+
+namespace {
+
+class WatchedShrinkable {
+public:
+  WatchedShrinkable(Shrinkable<CaseDescription> shrinkable,
+                    Reproduce reproduce,
+                    Watchdog &watchdog,
+                    std::shared_ptr<const TimeoutCallback> onTimeout)
+      : m_shrinkable(std::move(shrinkable))
+      , m_reproduce(std::move(reproduce))
+      , m_watchdog(&watchdog)
+      , m_onTimeout(std::move(onTimeout)) {}
+
+  CaseDescription value() const {
+    return watch([&] { return m_shrinkable.value(); });
+  }
+
+  Seq<Shrinkable<CaseDescription>> shrinks() const {
+    const auto reproduce = m_reproduce;
+    const auto watchdog = m_watchdog;
+    const auto onTimeout = m_onTimeout;
+    // Shrinks are often found by running the test case again
+    return seq::zipWith(
+        [=](std::size_t i, Shrinkable<CaseDescription> &&shrink) {
+          auto shrinkReproduce = reproduce;
+          shrinkReproduce.shrinkPath.push_back(i);
+          return makeShrinkable<WatchedShrinkable>(std::move(shrink),
+                                                   std::move(shrinkReproduce),
+                                                   *watchdog,
+                                                   onTimeout);
+        },
+        seq::index(),
+        watch([&] { return m_shrinkable.shrinks(); }));
+  }
+
+private:
+  template <typename Callable>
+  Decay<ReturnType<Callable>> watch(const Callable &callable) const {
+    // Replayed choices are not part of the reproduce information
+    Maybe<Reproduce> reproduce;
+    const auto source = ChoiceSource::current();
+    if (!source || !source->replaying()) {
+      reproduce = m_reproduce;
+    }
+
+    const auto onTimeout = m_onTimeout;
+    m_watchdog->start([=] { (*onTimeout)(reproduce); });
+    try {
+      auto result = callable();
+      m_watchdog->stop();
+      return result;
+    } catch (...) {
+      m_watchdog->stop();
+      throw;
+    }
+  }
+
+  Shrinkable<CaseDescription> m_shrinkable;
+  Reproduce m_reproduce;
+  Watchdog *m_watchdog;
+  std::shared_ptr<const TimeoutCallback> m_onTimeout;
+};
+
+} // namespace
+
+Property watchProperty(const Property &property,
+                       Watchdog &watchdog,
+                       TimeoutCallback onTimeout) {
+  const auto callback =
+      std::make_shared<const TimeoutCallback>(std::move(onTimeout));
+  const auto watchdogPtr = &watchdog;
+  return [=](const Random &random, int size) {
+    Reproduce reproduce;
+    reproduce.random = random;
+    reproduce.size = size;
+    return makeShrinkable<WatchedShrinkable>(
+        property(random, size), std::move(reproduce), *watchdogPtr, callback);
+  };
+}
+
+} // namespace detail
+} // namespace rc
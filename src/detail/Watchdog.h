@@ -0,0 +1,59 @@
+#pragma once
+
+#include <chrono>
+#include <condition_variable>
+#include <functional>
+#include <mutex>
+#include <thread>
+
+#include "rapidcheck/detail/Property.h"
+#include "rapidcheck/detail/Results.h"
+
+namespace rc {
+namespace detail {
+
+/// Calls a function on a separate thread when a test case runs for longer than
+/// the timeout. A test case that runs in the testing process cannot be stopped
+/// so the function is typically expected to report the timeout and terminate
+/// the process.
+class Watchdog {
+public:
+  explicit Watchdog(std::chrono::milliseconds timeout);
+  ~Watchdog();
+
+  /// Starts watching a test case. Unless `stop` is called before the timeout,
+  /// `onTimeout` is called from the watchdog thread.
+  void start(std::function<void()> onTimeout);
+
+  /// Stops watching the current test case.
+  void stop();
+
+private:
+  Watchdog(const Watchdog &) = delete;
+  Watchdog &operator=(const Watchdog &) = delete;
+
+  void run();
+
+  std::chrono::milliseconds m_timeout;
+  std::mutex m_mutex;
+  std::condition_variable m_condition;
+  std::function<void()> m_onTimeout;
+  std::chrono::steady_clock::time_point m_deadline;
+  bool m_watching;
+  bool m_idle;
+  bool m_quit;
+  std::thread m_thread;
+};
+
+/// Called with the `Reproduce` of a test case that timed out or `Nothing` if it
+/// was replayed from choices and cannot be reproduced that way.
+using TimeoutCallback = std::function<void(const Maybe<Reproduce> &)>;
+
+/// Returns a property that is equivalent to `property` but where every test
+/// case, including the shrinks, is watched by `watchdog`.
+Property watchProperty(const Property &property,
+                       Watchdog &watchdog,
+                       TimeoutCallback onTimeout);
+
+} // namespace detail
+} // namespace rc
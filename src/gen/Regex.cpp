@@ -0,0 +1,64 @@
+#include "rapidcheck/gen/Text.h"
+
+#include <memory>
+#include <utility>
+
+#include "rapidcheck/GenerationFailure.h"
+#include "rapidcheck/seq/Transform.h"
+#include "rapidcheck/shrink/Shrink.h"
+#include "rapidcheck/shrinkable/Create.h"
+#include "rapidcheck/shrinkable/Transform.h"
+
+#include "../detail/ParseException.h"
+#include "../detail/Regex.h"
+
+namespace rc {
+namespace gen {
+
+Gen<std::string> regex(const std::string &pattern) {
+  using Choices = std::vector<std::uint32_t>;
+  // The string is kept next to its choices so that every candidate is only
+  // interpreted once
+  using Candidate = std::pair<Choices, std::string>;
+  std::shared_ptr<const rc::detail::RegexProgram> program;
+  std::string error;
+  try {
+    program = std::make_shared<const rc::detail::RegexProgram>(
+        rc::detail::compileRegex(pattern));
+  } catch (const rc::detail::ParseException &e) {
+    error = "Invalid regular expression '" + pattern + "' " + e.what();
+  }
+
+  const auto interpret = [=](Choices &&choices) {
+    auto str = program->interpret(choices);
+    return Candidate(std::move(choices), std::move(str));
+  };
+
+  return [=](const Random &random, int size) {
+    if (!program) {
+      throw GenerationFailure(error);
+    }
+
+    return shrinkable::map(
+        shrinkable::shrinkRecur(
+            interpret(program->generate(random, size)),
+            [=](const Candidate &candidate) {
+              const auto &choices = candidate.first;
+              const auto str = candidate.second;
+              auto shrinks = seq::concat(
+                  shrink::removeChunks(choices),
+                  shrink::eachElement(choices, [](std::uint32_t x) {
+                    return shrink::towards<std::uint32_t>(x, 0);
+                  }));
+              // Different choices can describe the same string
+              return seq::filter(seq::map(std::move(shrinks), interpret),
+                                 [=](const Candidate &shrink) {
+                                   return shrink.second != str;
+                                 });
+            }),
+        [](const Candidate &candidate) { return candidate.second; });
+  };
+}
+
+} // namespace gen
+} // namespace rc
@@ -1,6 +1,109 @@
 #include "rapidcheck/gen/Text.h"
 
+#include <algorithm>
+#include <unordered_set>
+
 template rc::Gen<std::string> rc::gen::string<std::string>();
 template rc::Gen<std::wstring> rc::gen::string<std::wstring>();
 template struct rc::Arbitrary<std::string>;
 template struct rc::Arbitrary<std::wstring>;
+
+namespace rc {
+namespace gen {
+namespace {
+
+/// Charsets with at most this many code points use a flat lookup table.
+constexpr std::size_t kMaxTableSize = 4096;
+
+const std::vector<Charset::Range> kAsciiPrintableRanges = {{'a', 'z'},
+                                                           {'A', 'Z'},
+                                                           {'0', '9'},
+                                                           {' ', '/'},
+                                                           {':', '@'},
+                                                           {'[', '`'},
+                                                           {'{', '~'}};
+
+} // namespace
+
+Charset::Charset(const std::vector<Range> &ranges)
+    : m_size(0) {
+  for (const auto &range : ranges) {
+    const auto last = std::min<char32_t>(range.second, 0x10FFFF);
+    if (range.first > last) {
+      continue;
+    }
+
+    // Skip surrogates
+    if (range.first < 0xD800) {
+      addRange(range.first, std::min<char32_t>(last, 0xD7FF));
+    }
+    if (last > 0xDFFF) {
+      addRange(std::max<char32_t>(range.first, 0xE000), last);
+    }
+  }
+
+  if (m_size <= kMaxTableSize) {
+    m_table.reserve(m_size);
+    for (const auto &range : m_ranges) {
+      for (auto c = range.first; c <= range.second; c++) {
+        m_table.push_back(c);
+      }
+    }
+  }
+}
+
+void Charset::addRange(char32_t first, char32_t last) {
+  m_ranges.emplace_back(first, last);
+  m_offsets.push_back(m_size);
+  m_size += static_cast<std::size_t>(last - first) + 1;
+}
+
+Charset Charset::of(const std::u32string &chars) {
+  std::vector<Range> ranges;
+  ranges.reserve(chars.size());
+  std::unordered_set<char32_t> seen;
+  for (const auto c : chars) {
+    // Only the first occurrence counts, duplicates would skew the distribution
+    if (seen.insert(c).second) {
+      ranges.emplace_back(c, c);
+    }
+  }
+  return Charset(ranges);
+}
+
+Charset Charset::asciiPrintable() { return Charset(kAsciiPrintableRanges); }
+
+Charset Charset::plane(unsigned int n) {
+  if (n > 16) {
+    return Charset(std::vector<Range>());
+  }
+
+  const auto first = static_cast<char32_t>(n) << 16;
+  const auto last = first + 0xFFFF;
+  if (n == 0) {
+    // Skip C0 and C1 control characters
+    auto ranges = kAsciiPrintableRanges;
+    ranges.emplace_back(0xA0, last);
+    return Charset(ranges);
+  }
+  return Charset(std::vector<Range>{Range(first, last)});
+}
+
+Charset Charset::unicode() {
+  auto ranges = kAsciiPrintableRanges;
+  ranges.emplace_back(0xA0, 0x10FFFF);
+  return Charset(ranges);
+}
+
+char32_t Charset::operator[](std::size_t i) const {
+  if (!m_table.empty()) {
+    return m_table[i];
+  }
+
+  const auto it = std::upper_bound(begin(m_offsets), end(m_offsets), i) - 1;
+  const auto range = m_ranges[static_cast<std::size_t>(it - begin(m_offsets))];
+  return range.first + static_cast<char32_t>(i - *it);
+}
+
+} // namespace gen
+} // namespace rc
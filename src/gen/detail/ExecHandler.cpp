@@ -1,7 +1,11 @@
 #include "rapidcheck/gen/detail/ExecHandler.h"
 
+#include <exception>
+
 #include "rapidcheck/Gen.h"
 
+#include "IngredientObserver.h"
+
 namespace rc {
 namespace gen {
 namespace detail {
@@ -9,7 +13,40 @@ namespace detail {
 ExecHandler::ExecHandler(Recipe &recipe)
     : m_recipe(recipe)
     , m_random(m_recipe.random)
-    , m_it(begin(m_recipe.ingredients)) {}
+    , m_it(begin(m_recipe.ingredients))
+    , m_observer(rc::detail::ImplicitParam<
+                 param::CurrentIngredientObserver>::value()) {}
+
+void ExecHandler::onGenerateValue(GenerationRequest &request) {
+  rc::detail::ImplicitScope newScope;
+
+  Random random = m_random.split();
+  if (m_it == end(m_recipe.ingredients)) {
+    // The value is set directly from the generated shrinkable, no need to
+    // extract it from the ingredient
+    Maybe<Shrinkable<rc::detail::Any>> generated;
+    std::exception_ptr error;
+    try {
+      generated = request.generate(random, m_recipe.size);
+    } catch (...) {
+      // Generation failed but the ingredient must still be recorded so that
+      // the failure shows up in the counterexample
+      error = std::current_exception();
+      generated = shrinkable::lambda(
+          [=]() -> rc::detail::Any { std::rethrow_exception(error); });
+    }
+
+    m_it = m_recipe.ingredients.emplace(
+        m_it, request.name(), std::move(*generated));
+    onIngredientAdded(m_it++);
+    if (error) {
+      std::rethrow_exception(error);
+    }
+    return;
+  }
+  auto current = m_it++;
+  request.setValue(current->shrinkable.value());
+}
 
 rc::detail::Any ExecHandler::onGenerate(const Gen<rc::detail::Any> &gen) {
   rc::detail::ImplicitScope newScope;
@@ -17,12 +54,19 @@ rc::detail::Any ExecHandler::onGenerate(const Gen<rc::detail::Any> &gen) {
   Random random = m_random.split();
   if (m_it == end(m_recipe.ingredients)) {
     m_it = m_recipe.ingredients.emplace(
-        m_it, gen.name(), gen(random, m_recipe.size));
+        m_it, rc::detail::nameOf(gen), gen(random, m_recipe.size));
+    onIngredientAdded(m_it);
   }
   auto current = m_it++;
   return current->shrinkable.value();
 }
 
+void ExecHandler::onIngredientAdded(Iterator it) {
+  if (m_observer) {
+    m_observer(*it);
+  }
+}
+
 } // namespace detail
 } // namespace gen
 } // namespace rc
@@ -2,6 +2,7 @@
 
 #include <stdexcept>
 
+#include "rapidcheck/Gen.h"
 #include "rapidcheck/detail/Any.h"
 
 namespace rc {
@@ -17,6 +18,10 @@ class NullGenerationHandler : public GenerationHandler {
   }
 };
 
+void GenerationHandler::onGenerateValue(GenerationRequest &request) {
+  request.setValue(onGenerate(request.erased()));
+}
+
 namespace param {
 
 GenerationHandler *CurrentHandler::defaultValue() {
@@ -0,0 +1,22 @@
+#pragma once
+
+#include "rapidcheck/detail/ImplicitParam.h"
+#include "rapidcheck/gen/detail/ExecHandler.h"
+
+namespace rc {
+namespace gen {
+namespace detail {
+namespace param {
+
+/// The observer of the ingredients added by an `ExecHandler` that is created
+/// while this is bound. Handlers of nested generators run in a new implicit
+/// scope and are thus not observed.
+struct CurrentIngredientObserver {
+  using ValueType = ExecHandler::IngredientObserver;
+  static ValueType defaultValue() { return nullptr; }
+};
+
+} // namespace param
+} // namespace detail
+} // namespace gen
+} // namespace rc
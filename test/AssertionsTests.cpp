@@ -2,6 +2,7 @@
 #include <rapidcheck/catch.h>
 
 #include <algorithm>
+#include <thread>
 
 #include "util/Generators.h"
 
@@ -18,6 +19,15 @@ bool descriptionContains(const CaseResult &result, const std::string &substr) {
   return stringContains(result.description, substr);
 }
 
+struct TargetCollector : public PropertyContext {
+  bool reportResult(const CaseResult &) override { return false; }
+  std::ostream &logStream() override { return std::cerr; }
+  void addTag(std::string str) override {}
+  void addTarget(double value) override { targets.push_back(value); }
+
+  std::vector<double> targets;
+};
+
 } // namespace
 
 TEST_CASE("makeMessage") {
@@ -91,6 +101,41 @@ TEST_CASE("makeWrongExceptionMessage") {
   }
 }
 
+TEST_CASE("makeBudgetMessage") {
+  SECTION("message contains assertion") {
+    REQUIRE(stringContains(
+        makeBudgetMessage("",
+                          0,
+                          "ASSERT_IT(foo)",
+                          kBudgetAttempts,
+                          std::chrono::nanoseconds(0),
+                          std::chrono::nanoseconds(0)),
+        "ASSERT_IT(foo)"));
+  }
+
+  SECTION("message contains elapsed time and budget") {
+    const auto msg = makeBudgetMessage("",
+                                       0,
+                                       "",
+                                       3,
+                                       std::chrono::microseconds(2500),
+                                       std::chrono::microseconds(20));
+    REQUIRE(stringContains(msg, "3 attempts"));
+    REQUIRE(stringContains(msg, "2.5 ms"));
+    REQUIRE(stringContains(msg, "20 us"));
+  }
+
+  SECTION("message contains file and line") {
+    REQUIRE(stringContains(makeBudgetMessage("foo.cpp",
+                                             1337,
+                                             "",
+                                             kBudgetAttempts,
+                                             std::chrono::nanoseconds(0),
+                                             std::chrono::nanoseconds(0)),
+                           "foo.cpp:1337"));
+  }
+}
+
 TEST_CASE("doAssert") {
   SECTION("does nothing if expression equals expected result") {
     doAssert(
@@ -178,6 +223,57 @@ TEST_CASE("assertions") {
     }
   }
 
+  SECTION("RC_ASSERT_WITHIN") {
+    TargetCollector collector;
+    ImplicitParam<param::CurrentPropertyContext> letContext(&collector);
+
+    SECTION("does not throw if expression is within budget") {
+      RC_ASSERT_WITHIN(std::chrono::hours(1), x++);
+      REQUIRE(x == 1);
+      REQUIRE(collector.targets.size() == 1U);
+      REQUIRE(collector.targets[0] < 1.0);
+    }
+
+    SECTION("when over budget, throws Failure with relevant info") {
+      try {
+        RC_ASSERT_WITHIN(
+            std::chrono::microseconds(1),
+            (x++, std::this_thread::sleep_for(std::chrono::milliseconds(1))));
+        FAIL("Never threw");
+      } catch (const CaseResult &result) {
+        REQUIRE(x == kBudgetAttempts);
+        REQUIRE(result.type == CaseResult::Type::Failure);
+        REQUIRE(descriptionContains(result, "RC_ASSERT_WITHIN("));
+        REQUIRE(descriptionContains(result, "1 us"));
+        REQUIRE(collector.targets.size() == 1U);
+        REQUIRE(collector.targets[0] > 1.0);
+      }
+    }
+
+    SECTION("does not throw if a later evaluation is within budget") {
+      RC_ASSERT_WITHIN(
+          std::chrono::milliseconds(50),
+          (x++ == 0) &&
+              (std::this_thread::sleep_for(std::chrono::milliseconds(100)),
+               true));
+      REQUIRE(x == 2);
+    }
+
+    SECTION("evaluates at most the given number of attempts") {
+      try {
+        RC_ASSERT_WITHIN_ATTEMPTS(
+            std::chrono::microseconds(1),
+            1,
+            (x++, std::this_thread::sleep_for(std::chrono::milliseconds(1))));
+        FAIL("Never threw");
+      } catch (const CaseResult &result) {
+        REQUIRE(x == 1);
+        REQUIRE(result.type == CaseResult::Type::Failure);
+        REQUIRE(descriptionContains(result, "RC_ASSERT_WITHIN_ATTEMPTS("));
+      }
+    }
+  }
+
   SECTION("RC_ASSERT_FALSE") {
     SECTION("does not throw if expression is false") {
       RC_ASSERT_FALSE(100 == 101);
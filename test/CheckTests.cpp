@@ -111,7 +111,7 @@ TEST_CASE("checkTestable") {
 
          // Then reproduce it
          std::unordered_map<std::string, Reproduce> reproMap{
-             {metadata.id, failure.reproduce}};
+             {metadata.id, *failure.reproduce}};
          const auto reproduced =
              checkTestable(testable, metadata, params, dummyListener, reproMap);
 
@@ -150,7 +150,7 @@ TEST_CASE("checkTestable") {
 
          // Then we reproduce it
          std::unordered_map<std::string, Reproduce> reproMap{
-             {metadata.id, failure.reproduce}};
+             {metadata.id, *failure.reproduce}};
          auto noshrinkParams = params;
          noshrinkParams.disableShrinking = true;
          const auto reproduced = checkProperty(
@@ -159,17 +159,18 @@ TEST_CASE("checkTestable") {
          // Here we invoke the property directly to have the unshrunk version to
          // assert against
          auto noshrinkDesc =
-             property(failure.reproduce.random, failure.reproduce.size).value();
+             property(failure.reproduce->random, failure.reproduce->size)
+                 .value();
 
          FailureResult reproducedFailure;
          RC_ASSERT(reproduced.match(reproducedFailure));
          RC_ASSERT(reproducedFailure.description ==
                    noshrinkDesc.result.description);
-         RC_ASSERT(reproducedFailure.reproduce.random ==
-                   failure.reproduce.random);
-         RC_ASSERT(reproducedFailure.reproduce.size ==
-                   failure.reproduce.size);
-         RC_ASSERT(reproducedFailure.reproduce.shrinkPath.empty());
+         RC_ASSERT(reproducedFailure.reproduce->random ==
+                   failure.reproduce->random);
+         RC_ASSERT(reproducedFailure.reproduce->size ==
+                   failure.reproduce->size);
+         RC_ASSERT(reproducedFailure.reproduce->shrinkPath.empty());
          RC_ASSERT(reproducedFailure.counterExample == noshrinkDesc.example());
          RC_ASSERT(reproducedFailure.numSuccess == 0);
        });
@@ -28,6 +28,26 @@ struct MockGenerationHandler : public GenerationHandler {
   int returnValue;
 };
 
+struct MockRequestHandler : public GenerationHandler {
+  void onGenerateValue(GenerationRequest &request) override {
+    name = request.name();
+    if (generate) {
+      shrinkable = request.generate(Random(), 0);
+    } else {
+      request.setValue(Any::of(returnValue));
+    }
+  }
+
+  Any onGenerate(const Gen<Any> &/*gen*/) override {
+    throw std::runtime_error("onGenerate should not be called");
+  }
+
+  bool generate = true;
+  std::shared_ptr<const std::string> name;
+  Shrinkable<Any> shrinkable = shrinkable::lambda([] { return Any::of(0); });
+  int returnValue;
+};
+
 Gen<int> makeDummyGen() { return fn::constant(shrinkable::just(0)); }
 
 } // namespace
@@ -116,6 +136,36 @@ TEST_CASE("Gen") {
     SECTION("returns what is returned by onGenerate") { RC_ASSERT(x == 456); }
   }
 
+  SECTION("operator* with onGenerateValue") {
+    ImplicitScope scope;
+    MockRequestHandler handler;
+    ImplicitParam<rc::gen::detail::param::CurrentHandler> letHandler(&handler);
+    const auto gen = Gen<int>(fn::constant(shrinkable::just(1337))).as("foo");
+
+    SECTION("returns the generated value") {
+      REQUIRE(*gen == 1337);
+    }
+
+    SECTION("generate returns the erased shrinkable") {
+      *gen;
+      auto result =
+          shrinkable::map(handler.shrinkable,
+                          [](Any &&any) { return std::move(any.get<int>()); });
+      REQUIRE(result == shrinkable::just(1337));
+    }
+
+    SECTION("passes the name of the generator") {
+      *gen;
+      REQUIRE(handler.name == rc::detail::nameOf(gen));
+    }
+
+    SECTION("returns the value passed to setValue") {
+      handler.generate = false;
+      handler.returnValue = 456;
+      REQUIRE(*gen == 456);
+    }
+  }
+
   SECTION("as") {
     SECTION("has implementation identical to original generator") {
       Gen<std::string> g1(
@@ -0,0 +1,47 @@
+#include <catch2/catch.hpp>
+#include <rapidcheck/catch.h>
+
+using namespace rc;
+using namespace rc::detail;
+
+struct TargetCollector : public PropertyContext {
+  bool reportResult(const CaseResult &) override { return false; }
+  std::ostream &logStream() override { RC_FAIL("Shouldn't be called"); }
+  void addTag(std::string str) override {}
+  void addTarget(double value) override { targets.push_back(value); }
+
+  std::vector<double> targets;
+};
+
+TEST_CASE("RC_TARGET") {
+  prop("reports the value to the current context",
+       [](double value) {
+         TargetCollector collector;
+         ImplicitParam<param::CurrentPropertyContext> letContext(&collector);
+         RC_TARGET(value);
+         RC_ASSERT(collector.targets == std::vector<double>{value});
+       });
+
+  prop("does not fail if the value does not exceed the threshold",
+       [](double value) {
+         TargetCollector collector;
+         ImplicitParam<param::CurrentPropertyContext> letContext(&collector);
+         RC_TARGET(value, value);
+         RC_ASSERT(collector.targets == std::vector<double>{value});
+       });
+
+  prop("fails if the value exceeds the threshold",
+       [](int value) {
+         TargetCollector collector;
+         ImplicitParam<param::CurrentPropertyContext> letContext(&collector);
+         try {
+           RC_TARGET(value, value - 1.0);
+         } catch (const CaseResult &result) {
+           RC_ASSERT(result.type == CaseResult::Type::Failure);
+           RC_ASSERT(collector.targets ==
+                     std::vector<double>{static_cast<double>(value)});
+           return;
+         }
+         RC_FAIL("Did not fail");
+       });
+}
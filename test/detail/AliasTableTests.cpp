@@ -0,0 +1,85 @@
+#include <catch2/catch.hpp>
+#include <rapidcheck/catch.h>
+
+#include <cmath>
+#include <limits>
+#include <numeric>
+
+#include "rapidcheck/detail/AliasTable.h"
+
+#include "util/ArbitraryRandom.h"
+
+using namespace rc;
+using namespace rc::detail;
+
+TEST_CASE("AliasTable") {
+  static const auto genFrequencies = gen::nonEmpty(
+      gen::container<std::vector<std::size_t>>(gen::inRange(0, 10000)));
+
+  SECTION("sum") {
+    prop("returns sum of frequencies",
+         [] {
+           const auto frequencies = *genFrequencies;
+           const auto expected = std::accumulate(
+               begin(frequencies), end(frequencies), std::size_t(0));
+
+           RC_ASSERT(AliasTable(frequencies).sum() == expected);
+         });
+  }
+
+  SECTION("lookup") {
+    prop("never returns index of zero weight",
+         [](std::uint64_t x) {
+           const auto frequencies = *genFrequencies;
+           AliasTable table(frequencies);
+           RC_PRE(table.sum() != 0U);
+
+           const auto i = table.lookup(x);
+           RC_ASSERT(i < frequencies.size());
+           RC_ASSERT(frequencies[i] != 0U);
+         });
+
+    prop("respects weights",
+         [](const Random &random) {
+           const auto frequencies = *gen::nonEmpty(
+               gen::container<std::vector<std::size_t>>(gen::inRange(0, 10)));
+           AliasTable table(frequencies);
+           RC_PRE(table.sum() != 0U);
+
+           const auto n = 20000;
+           std::vector<int> counts(frequencies.size(), 0);
+           Random r(random);
+           for (int i = 0; i < n; i++) {
+             counts[table.lookup(r.next())]++;
+           }
+
+           for (std::size_t i = 0; i < frequencies.size(); i++) {
+             const auto expected = static_cast<double>(frequencies[i]) /
+                 static_cast<double>(table.sum());
+             const auto actual = static_cast<double>(counts[i]) / n;
+             RC_ASSERT(std::abs(actual - expected) < 0.02);
+           }
+         });
+
+    prop("respects weights that would overflow when scaled",
+         [](const Random &random) {
+           const auto max = std::numeric_limits<std::size_t>::max();
+           const std::vector<std::size_t> frequencies{
+               max / 2, 0, max / 4, 1};
+           AliasTable table(frequencies);
+
+           const auto n = 20000;
+           std::vector<int> counts(frequencies.size(), 0);
+           Random r(random);
+           for (int i = 0; i < n; i++) {
+             counts[table.lookup(r.next())]++;
+           }
+
+           RC_ASSERT(counts[1] == 0);
+           RC_ASSERT(std::abs(static_cast<double>(counts[0]) / n - 2.0 / 3.0) <
+                     0.02);
+           RC_ASSERT(std::abs(static_cast<double>(counts[2]) / n - 1.0 / 3.0) <
+                     0.02);
+         });
+  }
+}
@@ -0,0 +1,69 @@
+#include <catch2/catch.hpp>
+#include <rapidcheck/catch.h>
+
+#include <cmath>
+
+#include "rapidcheck/detail/BoundedRandom.h"
+
+#include "util/ArbitraryRandom.h"
+
+using namespace rc;
+using namespace rc::detail;
+
+TEST_CASE("multiply128") {
+  prop("low half is the wrapped product",
+       [](std::uint64_t a, std::uint64_t b) {
+         std::uint64_t high;
+         std::uint64_t low;
+         multiply128(a, b, high, low);
+         RC_ASSERT(low == a * b);
+       });
+
+  prop("high half is correct for 32-bit factors",
+       [](std::uint32_t a, std::uint64_t b) {
+         std::uint64_t high;
+         std::uint64_t low;
+         multiply128(a, b, high, low);
+         const auto expected =
+             (static_cast<std::uint64_t>(a) * (b >> 32) +
+              ((static_cast<std::uint64_t>(a) * (b & 0xFFFFFFFFULL)) >> 32)) >>
+             32;
+         RC_ASSERT(high == expected);
+       });
+}
+
+TEST_CASE("nextBounded") {
+  prop("returns a value less than the bound",
+       [](Random random, std::uint64_t n) {
+         RC_PRE(n != 0U);
+         RC_ASSERT(nextBounded(random, n) < n);
+       });
+
+  prop("uses full range for a zero bound",
+       [](const Random &random) {
+         auto r1 = random;
+         auto r2 = random;
+         RC_ASSERT(nextBounded(r1, 0) == r2.next());
+       });
+
+  prop("same Random yields same value",
+       [](const Random &random, std::uint64_t n) {
+         RC_ASSERT(nextBounded(Random(random), n) ==
+                   nextBounded(Random(random), n));
+       });
+
+  prop("values are roughly uniformly distributed",
+       [](Random random) {
+         const auto n = *gen::inRange<std::uint64_t>(1, 10);
+         const auto kTotal = 10000;
+         std::vector<int> counts(static_cast<std::size_t>(n), 0);
+         for (int i = 0; i < kTotal; i++) {
+           counts[static_cast<std::size_t>(nextBounded(random, n))]++;
+         }
+
+         for (const auto count : counts) {
+           const auto p = count / static_cast<double>(kTotal);
+           RC_ASSERT(std::abs(p - (1.0 / n)) < 0.03);
+         }
+       });
+}
@@ -0,0 +1,74 @@
+#include <catch2/catch.hpp>
+#include <rapidcheck/catch.h>
+
+#include <algorithm>
+#include <numeric>
+
+#include "detail/ChoiceShrinking.h"
+
+using namespace rc;
+using namespace rc::detail;
+
+TEST_CASE("shrinkChoices") {
+  prop("finds the minimal value of a single choice",
+       [](std::uint64_t target) {
+         const auto value = *gen::inRange<std::uint64_t>(
+             target, std::numeric_limits<std::uint64_t>::max());
+         const auto result =
+             shrinkChoices({value}, [=](const Choices &candidate) {
+               return !candidate.empty() && (candidate[0] >= target);
+             });
+         RC_ASSERT(result == Choices{target});
+       });
+
+  prop("removes irrelevant choices",
+       [](const Choices &prefix, const Choices &suffix) {
+         auto choices = prefix;
+         choices.push_back(1000);
+         choices.insert(end(choices), begin(suffix), end(suffix));
+         const auto result =
+             shrinkChoices(choices, [](const Choices &candidate) {
+               return std::any_of(begin(candidate),
+                                  end(candidate),
+                                  [](std::uint64_t x) { return x >= 100; });
+             });
+         RC_ASSERT(result == Choices{100});
+       });
+
+  prop("sorts choices",
+       [] {
+         const auto result =
+             shrinkChoices({7, 3}, [](const Choices &candidate) {
+               return (candidate.size() == 2) && (candidate[0] != candidate[1]);
+             });
+         RC_ASSERT(result == (Choices{0, 1}));
+       });
+
+  prop("result is never larger than the original",
+       [](const Choices &choices) {
+         const auto sum = [](const Choices &c) {
+           return std::accumulate(begin(c), end(c), 0.0);
+         };
+         const auto limit = sum(choices) * *gen::inRange(0, 101) / 100.0;
+         const auto test = [=](const Choices &candidate) {
+           return sum(candidate) >= limit;
+         };
+         const auto result = shrinkChoices(choices, test);
+         RC_ASSERT(test(result));
+         RC_ASSERT(result.size() <= choices.size());
+       });
+
+  prop("keeps truncations made by the test",
+       [](const Choices &choices) {
+         RC_PRE(!choices.empty());
+         const auto result =
+             shrinkChoices(choices, [](Choices &candidate) {
+               if (candidate.empty()) {
+                 return false;
+               }
+               candidate.resize(1);
+               return true;
+             });
+         RC_ASSERT(result == Choices{0});
+       });
+}
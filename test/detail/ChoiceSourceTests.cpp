@@ -0,0 +1,145 @@
+#include <catch2/catch.hpp>
+#include <rapidcheck/catch.h>
+
+#include "detail/ChoiceSource.h"
+
+#include "util/ArbitraryRandom.h"
+
+using namespace rc;
+using namespace rc::detail;
+
+TEST_CASE("choicesFromBytes") {
+  SECTION("packs bytes in little-endian order") {
+    const std::uint8_t bytes[] = {1, 2, 3, 4, 5, 6, 7, 8, 9};
+    REQUIRE(choicesFromBytes(bytes, 9) ==
+            (Choices{0x0807060504030201ULL, 0x09ULL}));
+  }
+
+  SECTION("returns no choices for no bytes") {
+    REQUIRE(choicesFromBytes(nullptr, 0).empty());
+  }
+}
+
+TEST_CASE("ChoiceSource") {
+  prop("records the values drawn from Random",
+       [](Random random) {
+         auto expectedRandom = random;
+         std::vector<std::uint64_t> expected;
+         for (int i = 0; i < 10; i++) {
+           expected.push_back(expectedRandom.next());
+         }
+
+         ChoiceSource source;
+         std::vector<std::uint64_t> drawn;
+         {
+           ChoiceSourceScope scope(source);
+           for (int i = 0; i < 10; i++) {
+             drawn.push_back(random.next());
+           }
+         }
+
+         RC_ASSERT(drawn == expected);
+         RC_ASSERT(source.choices() == expected);
+         RC_ASSERT(source.numUsed() == expected.size());
+         RC_ASSERT(!source.overrun());
+       });
+
+  prop("replays the given choices",
+       [](Random random, const Choices &choices) {
+         ChoiceSource source(choices);
+         Choices drawn;
+         {
+           ChoiceSourceScope scope(source);
+           for (std::size_t i = 0; i < choices.size(); i++) {
+             drawn.push_back(random.next());
+           }
+         }
+
+         RC_ASSERT(drawn == choices);
+         RC_ASSERT(source.numUsed() == choices.size());
+         RC_ASSERT(!source.overrun());
+       });
+
+  prop("draws from copies of the same Random use the same choice",
+       [](Random random, const Choices &choices) {
+         RC_PRE(!choices.empty());
+         ChoiceSource source(choices);
+         std::uint64_t x1, x2, y;
+         {
+           ChoiceSourceScope scope(source);
+           auto copy = random;
+           x1 = random.next();
+           x2 = copy.next();
+           y = random.next();
+         }
+
+         RC_ASSERT(x1 == choices[0]);
+         RC_ASSERT(x2 == choices[0]);
+         if (choices.size() > 1) {
+           RC_ASSERT(y == choices[1]);
+         }
+         RC_ASSERT(source.numUsed() == 2U);
+       });
+
+  prop("falls back to Random and is overrun when out of choices",
+       [](Random random, const Choices &choices) {
+         auto expectedRandom = random;
+         for (std::size_t i = 0; i < choices.size(); i++) {
+           expectedRandom.next();
+         }
+
+         ChoiceSource source(choices);
+         std::uint64_t value;
+         {
+           ChoiceSourceScope scope(source);
+           for (std::size_t i = 0; i < choices.size(); i++) {
+             random.next();
+           }
+           value = random.next();
+         }
+
+         RC_ASSERT(value == expectedRandom.next());
+         RC_ASSERT(source.overrun());
+       });
+
+  prop("observed values bring another source to the same state",
+       [](Random random, const Choices &choices) {
+         ChoiceSource source(choices);
+         ChoiceSource mirror(choices);
+         source.setObserver([&](std::uint64_t value) { mirror.next(value); });
+         {
+           ChoiceSourceScope scope(source);
+           auto copy = random;
+           const auto n = *gen::inRange<std::size_t>(0, choices.size() + 5);
+           for (std::size_t i = 0; i < n; i++) {
+             random.next();
+           }
+           copy.next();
+         }
+
+         RC_ASSERT(mirror.choices() == source.choices());
+         RC_ASSERT(mirror.numUsed() == source.numUsed());
+         RC_ASSERT(mirror.overrun() == source.overrun());
+       });
+
+  SECTION("replaying") {
+    REQUIRE_FALSE(ChoiceSource().replaying());
+    REQUIRE(ChoiceSource(Choices{1, 2}).replaying());
+  }
+
+  SECTION("ChoiceSourceScope restores the previous source") {
+    REQUIRE(ChoiceSource::current() == nullptr);
+    ChoiceSource outer;
+    {
+      ChoiceSourceScope outerScope(outer);
+      REQUIRE(ChoiceSource::current() == &outer);
+      ChoiceSource inner;
+      {
+        ChoiceSourceScope innerScope(inner);
+        REQUIRE(ChoiceSource::current() == &inner);
+      }
+      REQUIRE(ChoiceSource::current() == &outer);
+    }
+    REQUIRE(ChoiceSource::current() == nullptr);
+  }
+}
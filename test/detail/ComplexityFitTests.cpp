@@ -0,0 +1,92 @@
+#include <catch2/catch.hpp>
+#include <rapidcheck/catch.h>
+
+#include <cmath>
+
+#include "detail/ComplexityFit.h"
+
+#include "util/Generators.h"
+
+using namespace rc;
+using namespace rc::detail;
+
+namespace {
+
+std::vector<ComplexitySample>
+makeSamples(const std::vector<int> &sizes,
+            const std::function<double(double)> &seconds) {
+  std::vector<ComplexitySample> samples;
+  for (const auto n : sizes) {
+    ComplexitySample sample;
+    sample.n = n;
+    sample.seconds = seconds(n);
+    samples.push_back(sample);
+  }
+  return samples;
+}
+
+Gen<std::vector<int>> genSizes() {
+  return gen::suchThat(
+      gen::container<std::vector<int>>(gen::inRange(0, 1000)),
+      [](const std::vector<int> &sizes) {
+        return std::set<int>(begin(sizes), end(sizes)).size() >= 3;
+      });
+}
+
+} // namespace
+
+TEST_CASE("fitComplexity") {
+  prop("fits exact curves",
+       [] {
+         const auto sizes = *genSizes();
+         const auto a = *gen::inRange(0, 1000) * 1e-6;
+         const auto b = *gen::inRange(1, 1000) * 1e-9;
+
+         RC_ASSERT(fitComplexity(makeSamples(sizes, [=](double) {
+                     return a;
+                   })) == Maybe<Complexity>(Complexity::Constant));
+         RC_ASSERT(fitComplexity(makeSamples(sizes, [=](double n) {
+                     return a + b * n;
+                   })) == Maybe<Complexity>(Complexity::Linear));
+         RC_ASSERT(fitComplexity(makeSamples(sizes, [=](double n) {
+                     return a + b * ((n > 1.0) ? (n * std::log2(n)) : 0.0);
+                   })) == Maybe<Complexity>(Complexity::Linearithmic));
+         RC_ASSERT(fitComplexity(makeSamples(sizes, [=](double n) {
+                     return a + b * n * n;
+                   })) == Maybe<Complexity>(Complexity::Quadratic));
+       });
+
+  SECTION("prefers the less complex class if the difference is noise") {
+    std::vector<int> sizes;
+    for (int n = 0; n < 100; n++) {
+      sizes.push_back(n);
+    }
+    const auto samples = makeSamples(sizes, [](double n) {
+      // Noise that grows a little with n, as noise often does
+      const auto noise = (static_cast<int>(n) % 2 == 0) ? 1.0 : -1.0;
+      return (n + noise * (1.0 + n / 100.0)) * 1e-6;
+    });
+
+    REQUIRE(fitComplexity(samples) == Maybe<Complexity>(Complexity::Linear));
+  }
+
+  SECTION("decreasing runtime is constant") {
+    const auto samples =
+        makeSamples({1, 2, 3, 4}, [](double n) { return 1.0 / n; });
+
+    REQUIRE(fitComplexity(samples) == Maybe<Complexity>(Complexity::Constant));
+  }
+
+  prop("returns Nothing if there are fewer than three distinct sizes",
+       [](const std::vector<double> &seconds) {
+         std::vector<ComplexitySample> samples;
+         for (std::size_t i = 0; i < seconds.size(); i++) {
+           ComplexitySample sample;
+           sample.n = i % 2;
+           sample.seconds = seconds[i];
+           samples.push_back(sample);
+         }
+
+         RC_ASSERT(!fitComplexity(samples));
+       });
+}
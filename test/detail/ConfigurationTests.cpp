@@ -5,6 +5,7 @@
 #include "util/Generators.h"
 
 #include "rapidcheck/detail/Configuration.h"
+#include "detail/Base64.h"
 
 using namespace rc;
 using namespace rc::detail;
@@ -62,6 +63,79 @@ TEST_CASE("configFromString") {
     REQUIRE_THROWS_AS(configFromString("noshrink=2"), ConfigurationException);
   }
 
+  SECTION("throws on invalid shrink engine") {
+    REQUIRE_THROWS_AS(configFromString("shrink_engine=foobar"),
+                      ConfigurationException);
+    REQUIRE_THROWS_AS(configFromString("shrink_engine=1"),
+                      ConfigurationException);
+  }
+
+  SECTION("throws on reproduce strings from older versions") {
+    std::unordered_map<std::string, Reproduce> reproduceMap;
+    reproduceMap.emplace("foobar", Reproduce());
+    std::vector<std::uint8_t> data;
+    serialize(reproduceMap, std::back_inserter(data));
+    try {
+      configFromString("reproduce=" + base64Encode(data));
+      FAIL("Did not throw");
+    } catch (const ConfigurationException &e) {
+      REQUIRE(std::string(e.what()).find("older version") !=
+              std::string::npos);
+    }
+  }
+
+  SECTION("throws on invalid size schedule") {
+    REQUIRE_THROWS_AS(configFromString("size_schedule=foobar"),
+                      ConfigurationException);
+    REQUIRE_THROWS_AS(configFromString("size_schedule=1"),
+                      ConfigurationException);
+  }
+
+  SECTION("throws on invalid coverage guided setting") {
+    REQUIRE_THROWS_AS(configFromString("coverage_guided=foo"),
+                      ConfigurationException);
+    REQUIRE_THROWS_AS(configFromString("coverage_guided=2"),
+                      ConfigurationException);
+  }
+
+  SECTION("throws on invalid fail fast setting") {
+    REQUIRE_THROWS_AS(configFromString("fail_fast=foo"),
+                      ConfigurationException);
+    REQUIRE_THROWS_AS(configFromString("fail_fast=2"), ConfigurationException);
+  }
+
+  SECTION("throws on invalid case timeout") {
+    REQUIRE_THROWS_AS(configFromString("case_timeout_ms=-1"),
+                      ConfigurationException);
+    REQUIRE_THROWS_AS(configFromString("case_timeout_ms=foo"),
+                      ConfigurationException);
+  }
+
+  SECTION("throws on invalid isolation") {
+    REQUIRE_THROWS_AS(configFromString("isolation=foobar"),
+                      ConfigurationException);
+    REQUIRE_THROWS_AS(configFromString("isolation=1"),
+                      ConfigurationException);
+  }
+
+  SECTION("throws on invalid memory limit") {
+    REQUIRE_THROWS_AS(configFromString("memory_limit_mb=-1"),
+                      ConfigurationException);
+    REQUIRE_THROWS_AS(configFromString("memory_limit_mb=foo"),
+                      ConfigurationException);
+  }
+
+  SECTION("throws on invalid shard settings") {
+    REQUIRE_THROWS_AS(configFromString("shard_count=0"),
+                      ConfigurationException);
+    REQUIRE_THROWS_AS(configFromString("shard_index=-1"),
+                      ConfigurationException);
+    REQUIRE_THROWS_AS(configFromString("shard_index=2 shard_count=2"),
+                      ConfigurationException);
+    REQUIRE_THROWS_AS(configFromString("shard_index=1"),
+                      ConfigurationException);
+  }
+
   SECTION("throws on invalid verbose progress setting") {
     REQUIRE_THROWS_AS(configFromString("verbose_progress=foo"),
                       ConfigurationException);
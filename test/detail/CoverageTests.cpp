@@ -0,0 +1,108 @@
+#include <catch2/catch.hpp>
+#include <rapidcheck/catch.h>
+
+#include <algorithm>
+
+#include "detail/Coverage.h"
+
+#include "util/ArbitraryRandom.h"
+
+using namespace rc;
+using namespace rc::detail;
+
+namespace {
+
+struct ScopedCounters {
+  ScopedCounters() {
+    std::fill(std::begin(counters), std::end(counters), 0);
+    registerCoverageCounters(std::begin(counters), std::end(counters));
+  }
+
+  ~ScopedCounters() { unregisterCoverageCounters(std::begin(counters)); }
+
+  std::uint8_t counters[4];
+};
+
+} // namespace
+
+TEST_CASE("CoverageTracker") {
+  SECTION("is disabled if there are no counters") {
+    REQUIRE(!CoverageTracker().enabled());
+  }
+
+  SECTION("is enabled if there are counters") {
+    ScopedCounters scoped;
+    REQUIRE(CoverageTracker().enabled());
+  }
+
+  SECTION("beginCase resets the counters") {
+    ScopedCounters scoped;
+    CoverageTracker tracker;
+    std::fill(std::begin(scoped.counters), std::end(scoped.counters), 10);
+    tracker.beginCase();
+    REQUIRE(std::all_of(std::begin(scoped.counters),
+                        std::end(scoped.counters),
+                        [](std::uint8_t x) { return x == 0; }));
+  }
+
+  SECTION("endCase returns true only if new features were reached") {
+    ScopedCounters scoped;
+    CoverageTracker tracker;
+
+    tracker.beginCase();
+    REQUIRE(!tracker.endCase());
+
+    tracker.beginCase();
+    scoped.counters[1] = 1;
+    REQUIRE(tracker.endCase());
+
+    tracker.beginCase();
+    scoped.counters[1] = 1;
+    REQUIRE(!tracker.endCase());
+
+    tracker.beginCase();
+    scoped.counters[1] = 2;
+    REQUIRE(tracker.endCase());
+
+    tracker.beginCase();
+    scoped.counters[1] = 5;
+    REQUIRE(tracker.endCase());
+
+    tracker.beginCase();
+    scoped.counters[1] = 6;
+    REQUIRE(!tracker.endCase());
+
+    tracker.beginCase();
+    scoped.counters[3] = 6;
+    REQUIRE(tracker.endCase());
+  }
+}
+
+TEST_CASE("CoverageCorpus") {
+  prop("mutate keeps the size of the entry",
+       [](Random random, const Choices &choices, int size) {
+         CoverageCorpus corpus;
+         corpus.add(choices, size);
+         RC_ASSERT(corpus.mutate(random).size == size);
+       });
+
+  prop("mutate picks entries from the corpus",
+       [](Random random, const std::vector<int> &sizes) {
+         RC_PRE(!sizes.empty());
+         CoverageCorpus corpus;
+         for (const auto size : sizes) {
+           corpus.add(Choices(), size);
+         }
+
+         const auto entry = corpus.mutate(random);
+         RC_ASSERT(std::find(begin(sizes), end(sizes), entry.size) !=
+                   end(sizes));
+       });
+
+  SECTION("is empty until entries are added") {
+    CoverageCorpus corpus;
+    REQUIRE(corpus.empty());
+    corpus.add(Choices(), 0);
+    REQUIRE(!corpus.empty());
+  }
+}
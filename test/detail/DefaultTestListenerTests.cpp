@@ -66,6 +66,7 @@ TEST_CASE("makeDefaultTestListener") {
     TestMetadata metadata;
     metadata.id = "foobar";
     FailureResult failure;
+    failure.reproduce = Reproduce();
     listener->onTestFinished(metadata, failure);
     listener.reset();
     REQUIRE(os.str().find("reproduce=") != std::string::npos);
@@ -0,0 +1,100 @@
+#include <catch2/catch.hpp>
+#include <rapidcheck/catch.h>
+
+#include "rapidcheck/detail/BoundedRandom.h"
+#include "rapidcheck/detail/Fuzzing.h"
+#include "detail/Testing.h"
+
+using namespace rc;
+using namespace rc::detail;
+
+namespace {
+
+std::vector<std::uint8_t> bytesOf(std::uint64_t x) {
+  std::vector<std::uint8_t> bytes;
+  for (int i = 0; i < 8; i++) {
+    bytes.push_back(static_cast<std::uint8_t>(x >> (i * 8)));
+  }
+  return bytes;
+}
+
+} // namespace
+
+TEST_CASE("fuzzProperty") {
+  prop("values are taken from the bytes",
+       [](std::uint64_t x) {
+         int value = -1;
+         const auto property =
+             toProperty([&] { value = *gen::inRange(0, kNominalSize); });
+         const auto bytes = bytesOf(x);
+         fuzzProperty(property, bytes.data(), bytes.size());
+
+         std::uint64_t high;
+         std::uint64_t low;
+         multiply128(x, kNominalSize, high, low);
+         RC_ASSERT(value == static_cast<int>(high));
+       });
+
+  prop("the same bytes give the same result",
+       [](const std::vector<std::uint8_t> &bytes) {
+         const auto property = toProperty([](const std::vector<int> &values) {
+           RC_ASSERT(values.size() < 10U);
+         });
+         RC_ASSERT(fuzzProperty(property, bytes.data(), bytes.size()) ==
+                   fuzzProperty(property, bytes.data(), bytes.size()));
+       });
+
+  prop("returns a FailureResult with counterexample on failure",
+       [](const std::vector<std::uint8_t> &bytes, const std::string &message) {
+         int value = 0;
+         const auto property = toProperty([&] {
+           value = *gen::arbitrary<int>();
+           RC_FAIL(message);
+         });
+         const auto result = fuzzProperty(property, bytes.data(), bytes.size());
+
+         FailureResult failure;
+         RC_ASSERT(result.match(failure));
+         RC_ASSERT(failure.description.find(message) != std::string::npos);
+         RC_ASSERT(failure.counterExample.size() == 1U);
+         RC_ASSERT(failure.counterExample.front().second == toString(value));
+       });
+
+  prop("failures can be reproduced",
+       [](const std::vector<std::uint8_t> &bytes) {
+         const auto property = toProperty([] {
+           *gen::arbitrary<std::vector<int>>();
+           RC_FAIL("Always fails");
+         });
+         const auto result = fuzzProperty(property, bytes.data(), bytes.size());
+         FailureResult failure;
+         RC_ASSERT(result.match(failure));
+
+         RC_ASSERT(failure.reproduce);
+         const auto reproduced =
+             reproduceProperty(property, *failure.reproduce);
+         FailureResult reproducedFailure;
+         RC_ASSERT(reproduced.match(reproducedFailure));
+         RC_ASSERT(reproducedFailure.counterExample == failure.counterExample);
+       });
+
+  prop("returns a GaveUpResult if the case is discarded",
+       [](const std::vector<std::uint8_t> &bytes, const std::string &message) {
+         const auto property = toProperty([&] { RC_DISCARD(message); });
+         const auto result = fuzzProperty(property, bytes.data(), bytes.size());
+
+         GaveUpResult gaveUp;
+         RC_ASSERT(result.match(gaveUp));
+         RC_ASSERT(gaveUp.description.find(message) != std::string::npos);
+       });
+
+  prop("returns a SuccessResult if the case succeeds",
+       [](const std::vector<std::uint8_t> &bytes) {
+         const auto result =
+             fuzzProperty(toProperty([] {}), bytes.data(), bytes.size());
+
+         SuccessResult success;
+         RC_ASSERT(result.match(success));
+         RC_ASSERT(success.numSuccess == 1);
+       });
+}
@@ -0,0 +1,233 @@
+#include <catch2/catch.hpp>
+#include <rapidcheck/catch.h>
+
+#include <poll.h>
+#include <unistd.h>
+
+#include <csignal>
+#include <cstdlib>
+#include <memory>
+#include <thread>
+
+#include "detail/ChoiceSource.h"
+#include "detail/Isolation.h"
+
+#include "util/ArbitraryRandom.h"
+
+using namespace rc;
+using namespace rc::detail;
+
+#ifndef _WIN32
+
+namespace {
+
+TestParams forkParams(int caseTimeoutMs = 0, int memoryLimitMb = 0) {
+  TestParams params;
+  params.isolation = CaseIsolation::Fork;
+  params.caseTimeoutMs = caseTimeoutMs;
+  params.memoryLimitMb = memoryLimitMb;
+  return params;
+}
+
+// Keeps allocations from being optimized away
+char *volatile allocated;
+
+bool startsWith(const std::string &str, const std::string &prefix) {
+  return str.compare(0, prefix.size(), prefix) == 0;
+}
+
+} // namespace
+
+TEST_CASE("isolateProperty") {
+  const auto property = toProperty([] {
+    const auto x = *gen::inRange(0, 100);
+    const auto s = *gen::string<std::string>();
+    RC_TAG(x % 3);
+    RC_TARGET(x);
+    RC_LOG() << s;
+    RC_ASSERT(x < 90);
+  });
+
+  prop("gives the same test cases as running in-process",
+       [&](const Random &random) {
+         const auto size = *gen::inRange(0, 200);
+         const auto isolated = isolateProperty(property, forkParams());
+         RC_ASSERT(isolated(random, size).value() ==
+                   property(random, size).value());
+       });
+
+  prop("passes the choices on to the current ChoiceSource",
+       [&](const Random &random) {
+         const auto size = *gen::inRange(0, 200);
+         const auto isolated = isolateProperty(property, forkParams());
+
+         ChoiceSource expected;
+         {
+           ChoiceSourceScope scope(expected);
+           property(random, size).value();
+         }
+
+         ChoiceSource actual;
+         {
+           ChoiceSourceScope scope(actual);
+           isolated(random, size).value();
+         }
+
+         RC_ASSERT(actual.choices() == expected.choices());
+       });
+
+  prop("passes the choices on to a ChoiceSource that has already been used",
+       [&](const Random &random) {
+         const auto size = *gen::inRange(0, 200);
+         const auto isolated = isolateProperty(property, forkParams());
+
+         ChoiceSource expected;
+         {
+           ChoiceSourceScope scope(expected);
+           Random(random).next();
+           property(random, size).value();
+         }
+
+         ChoiceSource actual;
+         {
+           ChoiceSourceScope scope(actual);
+           Random(random).next();
+           isolated(random, size).value();
+         }
+
+         RC_ASSERT(actual.choices() == expected.choices());
+       });
+
+  SECTION("fails test cases that time out") {
+    const auto hanging = toProperty([] {
+      const auto x = *gen::just(1337);
+      while (x != 0) {
+        std::this_thread::sleep_for(std::chrono::milliseconds(10));
+      }
+    });
+
+    const auto description =
+        isolateProperty(hanging, forkParams(50))(Random(), 0).value();
+    REQUIRE(description.result.type == CaseResult::Type::Failure);
+    REQUIRE(description.result.description ==
+            "Test case timed out after 50 ms");
+    // Values generated before the timeout are still shown
+    REQUIRE(description.example() == (Example{{"int", "1337"}}));
+  }
+
+  SECTION("fails test cases that exit without a result") {
+    const auto exiting = toProperty([] { std::_Exit(3); });
+    const auto description =
+        isolateProperty(exiting, forkParams())(Random(), 0).value();
+    REQUIRE(description.result.type == CaseResult::Type::Failure);
+    REQUIRE(description.result.description ==
+            "Test case exited with status 3 without reporting a result");
+  }
+
+  SECTION("fails test cases that crash") {
+    const auto crashing = toProperty([] {
+      const auto x = *gen::just(1337);
+      if (x != 0) {
+        std::raise(SIGSEGV);
+      }
+    });
+
+    const auto description =
+        isolateProperty(crashing, forkParams())(Random(), 0).value();
+    REQUIRE(description.result.type == CaseResult::Type::Failure);
+    REQUIRE(startsWith(description.result.description,
+                       "Test case was terminated by SIGSEGV"));
+    REQUIRE(description.example() == (Example{{"int", "1337"}}));
+  }
+
+  SECTION("keeps running test cases after one has crashed") {
+    const auto crashes = [] { return *gen::inRange(0, 2) == 0; };
+    const auto isolated = isolateProperty(toProperty([=] {
+                                            if (crashes()) {
+                                              std::abort();
+                                            }
+                                          }),
+                                          forkParams());
+    // Fails instead of crashing for the same test cases
+    const auto reference = toProperty([=] { RC_ASSERT(!crashes()); });
+
+    Random random;
+    for (int i = 0; i < 20; i++) {
+      const auto caseRandom = random.split();
+      const auto description = isolated(caseRandom, 0).value();
+      if (reference(caseRandom, 0).value().result.type ==
+          CaseResult::Type::Success) {
+        REQUIRE(description.result.type == CaseResult::Type::Success);
+      } else {
+        REQUIRE(startsWith(description.result.description,
+                           "Test case was terminated by SIGABRT"));
+      }
+    }
+  }
+
+  SECTION("keeps running test cases after one has timed out") {
+    const auto hangs = [] { return *gen::inRange(0, 2) == 0; };
+    const auto isolated = isolateProperty(toProperty([=] {
+                                            if (hangs()) {
+                                              std::this_thread::sleep_for(
+                                                  std::chrono::seconds(10));
+                                            }
+                                          }),
+                                          forkParams(50));
+    // Fails instead of hanging for the same test cases
+    const auto reference = toProperty([=] { RC_ASSERT(!hangs()); });
+
+    Random random;
+    for (int i = 0; i < 10; i++) {
+      const auto caseRandom = random.split();
+      const auto description = isolated(caseRandom, 0).value();
+      if (reference(caseRandom, 0).value().result.type ==
+          CaseResult::Type::Success) {
+        REQUIRE(description.result.type == CaseResult::Type::Success);
+      } else {
+        REQUIRE(description.result.description ==
+                "Test case timed out after 50 ms");
+      }
+    }
+  }
+
+  SECTION("stopping the server stops the processes it started") {
+    // The pipe is only closed once every process holding it is gone
+    int fds[2];
+    REQUIRE(pipe(fds) == 0);
+    {
+      const auto isolated = isolateProperty(toProperty([] {
+                                              if (fork() == 0) {
+                                                sleep(10);
+                                                std::_Exit(0);
+                                              }
+                                            }),
+                                            forkParams());
+      REQUIRE(isolated(Random(), 0).value().result.type ==
+              CaseResult::Type::Success);
+    }
+    close(fds[1]);
+
+    pollfd pfd;
+    pfd.fd = fds[0];
+    pfd.events = POLLIN;
+    REQUIRE(poll(&pfd, 1, 5000) == 1);
+    char c;
+    REQUIRE(read(fds[0], &c, 1) == 0);
+    close(fds[0]);
+  }
+
+  SECTION("limits the memory of test cases") {
+    const auto allocating = toProperty([] {
+      // The memory is never touched so it doesn't have to exist
+      std::unique_ptr<char[]> data(new char[std::size_t(1) << 31]);
+      allocated = data.get();
+    });
+
+    REQUIRE(isolateProperty(allocating, forkParams(0, 1024))(Random(), 0)
+                .value()
+                .result.type == CaseResult::Type::Failure);
+  }
+}
+
+#endif // _WIN32
@@ -18,6 +18,8 @@ TEST_CASE("CaseDescription") {
     propConformsToEquals<CaseDescription>();
     PROP_REPLACE_MEMBER_INEQUAL(CaseDescription, result);
     PROP_REPLACE_MEMBER_INEQUAL(CaseDescription, tags);
+    PROP_REPLACE_MEMBER_INEQUAL(CaseDescription, target);
+    PROP_REPLACE_MEMBER_INEQUAL(CaseDescription, complexity);
 
     prop("not equal if example not equal",
          [](const CaseDescription &original) {
@@ -143,6 +145,14 @@ TEST_CASE("PropertyAdapter") {
     REQUIRE(!descriptionContains(result, "Log:"));
   }
 
+  SECTION("includes log even if the log stream has failed") {
+    const auto result = makeAdapter([=] {
+      RC_LOG() << "foobar";
+      RC_LOG().setstate(std::ios::failbit);
+    })();
+    REQUIRE(descriptionContains(result, "Log:\nfoobar"));
+  }
+
   prop("returns CaseResult as is",
        [](const CaseResult &result) {
          RC_ASSERT(makeAdapter([=] { return result; })().result == result);
@@ -236,6 +246,65 @@ TEST_CASE("PropertyAdapter") {
 
          RC_ASSERT(result.tags == tags);
        });
+
+  prop("returns the highest target that was added",
+       [](const std::vector<int> &targets) {
+         const auto result = makeAdapter([&] {
+           for (const auto target : targets) {
+             ImplicitParam<param::CurrentPropertyContext>::value()->addTarget(
+                 target);
+           }
+         })();
+
+         if (targets.empty()) {
+           RC_ASSERT(!result.target);
+         RC_ASSERT(!result.complexity);
+         } else {
+           RC_ASSERT(*result.target ==
+                     *std::max_element(begin(targets), end(targets)));
+         }
+       });
+
+  prop("returns the last complexity sample that was added",
+       [](const std::vector<ComplexitySample> &samples) {
+         const auto result = makeAdapter([&] {
+           for (const auto &sample : samples) {
+             ImplicitParam<param::CurrentPropertyContext>::value()
+                 ->addComplexitySample(sample);
+           }
+         })();
+
+         if (samples.empty()) {
+           RC_ASSERT(!result.complexity);
+         } else {
+           RC_ASSERT(*result.complexity == samples.back());
+         }
+       });
+
+  prop("does not leak state from previous invocations",
+       [](const std::vector<std::string> &tags, const std::string &msg) {
+         makeAdapter([&] {
+           const auto context =
+               ImplicitParam<param::CurrentPropertyContext>::value();
+           for (const auto &tag : tags) {
+             context->addTag(tag);
+           }
+           context->addTarget(1.0);
+           context->addComplexitySample(ComplexitySample());
+           context->logStream() << std::hex << msg;
+           return false;
+         })();
+
+         const auto result = makeAdapter([] {
+           ImplicitParam<param::CurrentPropertyContext>::value()->logStream()
+               << 10;
+         })();
+         RC_ASSERT(result.result.type == CaseResult::Type::Success);
+         RC_ASSERT(result.tags.empty());
+         RC_ASSERT(!result.target);
+         RC_ASSERT(result.result.description ==
+                   "no exceptions thrown\n\nLog:\n10");
+       });
 }
 
 namespace {
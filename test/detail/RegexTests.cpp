@@ -0,0 +1,61 @@
+#include <catch2/catch.hpp>
+#include <rapidcheck/catch.h>
+
+#include "detail/ParseException.h"
+#include "detail/Regex.h"
+
+#include "util/ArbitraryRandom.h"
+
+using namespace rc;
+using namespace rc::detail;
+
+TEST_CASE("compileRegex") {
+  SECTION("no choices yield the simplest match") {
+    REQUIRE(compileRegex("abc").interpret({}) == "abc");
+    REQUIRE(compileRegex("[x-z]+").interpret({}) == "x");
+    REQUIRE(compileRegex("(foo|bar){2}").interpret({}) == "foofoo");
+    REQUIRE(compileRegex("a*b?").interpret({}) == "");
+    REQUIRE(compileRegex(".\\d\\w").interpret({}) == "a0a");
+  }
+
+  SECTION("choices select alternatives, repetitions and characters") {
+    const auto program = compileRegex("(foo|bar)+[0-9]");
+    REQUIRE(program.interpret({1, 1, 0, 7}) == "barfoo7");
+  }
+
+  SECTION("bounded repetitions are clamped") {
+    REQUIRE(compileRegex("a{1,3}").interpret({100}) == "aaa");
+  }
+
+  SECTION("negated classes exclude the given characters") {
+    const auto program = compileRegex("[^a-z]");
+    for (std::uint32_t i = 0; i < 200; i++) {
+      const auto str = program.interpret({i});
+      REQUIRE(str.size() == 1);
+      REQUIRE(!(str[0] >= 'a' && str[0] <= 'z'));
+    }
+  }
+
+  SECTION("anchors at start and end are allowed") {
+    REQUIRE(compileRegex("^ab$").interpret({}) == "ab");
+  }
+
+  SECTION("throws ParseException on invalid patterns") {
+    REQUIRE_THROWS_AS(compileRegex("(ab"), ParseException);
+    REQUIRE_THROWS_AS(compileRegex("ab)"), ParseException);
+    REQUIRE_THROWS_AS(compileRegex("+"), ParseException);
+    REQUIRE_THROWS_AS(compileRegex("[z-a]"), ParseException);
+    REQUIRE_THROWS_AS(compileRegex("a{3,2}"), ParseException);
+    REQUIRE_THROWS_AS(compileRegex("a^b"), ParseException);
+    REQUIRE_THROWS_AS(compileRegex("\\b"), ParseException);
+  }
+
+  prop("generated choices are interpreted consistently",
+       [](const Random &random) {
+         const auto program = compileRegex("((ab|c)*d{1,3})+");
+         const auto size = *gen::inRange(0, 200);
+         const auto choices = program.generate(random, size);
+         RC_ASSERT(program.interpret(choices) == program.interpret(choices));
+         RC_ASSERT(program.generate(random, size) == choices);
+       });
+}
@@ -19,6 +19,17 @@ TEST_CASE("ReproduceListener") {
          RC_ASSERT(os.str().empty());
        });
 
+  prop("ignores failures without reproduce",
+       [](const TestMetadata &metadata, FailureResult failure) {
+         std::ostringstream os;
+         {
+           ReproduceListener listener(os);
+           failure.reproduce.reset();
+           listener.onTestFinished(metadata, failure);
+         }
+         RC_ASSERT(os.str().empty());
+       });
+
   prop("output string on destruction contains entire reproduce map",
        [] {
          const auto reproduceMap = *gen::nonEmpty(
@@ -37,6 +37,8 @@ TEST_CASE("SuccessResult") {
     propConformsToEquals<SuccessResult>();
     PROP_REPLACE_MEMBER_INEQUAL(SuccessResult, numSuccess);
     PROP_REPLACE_MEMBER_INEQUAL(SuccessResult, distribution);
+    PROP_REPLACE_MEMBER_INEQUAL(SuccessResult, target);
+    PROP_REPLACE_MEMBER_INEQUAL(SuccessResult, complexity);
   }
 
   SECTION("operator<<") { propConformsToOutputOperator<SuccessResult>(); }
@@ -56,10 +58,31 @@ TEST_CASE("SuccessResult") {
                              });
              RC_ASSERT(messageContains(result, *someTag));
            }
+
+           if (result.target && !result.target->example.empty()) {
+             const auto item = *gen::elementOf(result.target->example);
+             RC_ASSERT(messageContains(result, item.first));
+             RC_ASSERT(messageContains(result, item.second));
+           }
+
+           if (result.complexity) {
+             RC_ASSERT(
+                 messageContains(result, toString(*result.complexity)));
+           }
          });
   }
 }
 
+TEST_CASE("TargetResult") {
+  SECTION("operator==/operator!=") {
+    propConformsToEquals<TargetResult>();
+    PROP_REPLACE_MEMBER_INEQUAL(TargetResult, value);
+    PROP_REPLACE_MEMBER_INEQUAL(TargetResult, example);
+  }
+
+  SECTION("operator<<") { propConformsToOutputOperator<TargetResult>(); }
+}
+
 
 TEST_CASE("Reproduce") {
   SECTION("operator==/operator!=") {
@@ -67,6 +90,7 @@ TEST_CASE("Reproduce") {
     PROP_REPLACE_MEMBER_INEQUAL(Reproduce, random);
     PROP_REPLACE_MEMBER_INEQUAL(Reproduce, size);
     PROP_REPLACE_MEMBER_INEQUAL(Reproduce, shrinkPath);
+    PROP_REPLACE_MEMBER_INEQUAL(Reproduce, choices);
   }
 
   SECTION("operator<<") { propConformsToOutputOperator<Reproduce>(); }
@@ -93,10 +117,11 @@ TEST_CASE("FailureResult") {
            RC_ASSERT(
                messageContains(result, std::to_string(result.numSuccess + 1)));
            RC_ASSERT(messageContains(result, result.description));
-           RC_ASSERT(
-               result.reproduce.shrinkPath.empty() ||
-               messageContains(
-                   result, std::to_string(result.reproduce.shrinkPath.size())));
+           RC_ASSERT(!result.reproduce ||
+                     result.reproduce->shrinkPath.empty() ||
+                     messageContains(
+                         result,
+                         std::to_string(result.reproduce->shrinkPath.size())));
            for (const auto &item : result.counterExample) {
              messageContains(result, item.first);
              messageContains(result, item.second);
@@ -0,0 +1,64 @@
+#include <catch2/catch.hpp>
+#include <rapidcheck/catch.h>
+
+#include <cstdlib>
+#include <limits>
+#include <map>
+#include <set>
+
+#include "rapidcheck/detail/Sampling.h"
+
+#include "util/ArbitraryRandom.h"
+
+using namespace rc;
+using namespace rc::detail;
+
+TEST_CASE("sampleWithoutReplacement") {
+  prop("returns the requested number of distinct values in range",
+       [](Random random) {
+         const auto n = *gen::inRange<std::uint64_t>(0, 10000);
+         const auto k = *gen::inRange<std::size_t>(0, n + 1);
+         const auto values = sampleWithoutReplacement(random, n, k);
+         RC_ASSERT(values.size() == k);
+         std::set<std::uint64_t> distinct(begin(values), end(values));
+         RC_ASSERT(distinct.size() == k);
+         if (!values.empty()) {
+           RC_ASSERT(*distinct.rbegin() < n);
+         }
+       });
+
+  prop("works with huge ranges",
+       [](Random random) {
+         const auto n = *gen::inRange<std::uint64_t>(
+             1, std::numeric_limits<std::uint64_t>::max());
+         const auto k = static_cast<std::size_t>(
+             std::min<std::uint64_t>(n, *gen::inRange<std::size_t>(0, 1000)));
+         const auto values = sampleWithoutReplacement(random, n, k);
+         std::set<std::uint64_t> distinct(begin(values), end(values));
+         RC_ASSERT(distinct.size() == k);
+       });
+
+  prop("same random yields same values",
+       [](const Random &random) {
+         const auto n = *gen::inRange<std::uint64_t>(0, 10000);
+         const auto k = *gen::inRange<std::size_t>(0, n + 1);
+         Random r1(random);
+         Random r2(random);
+         RC_ASSERT(sampleWithoutReplacement(r1, n, k) ==
+                   sampleWithoutReplacement(r2, n, k));
+       });
+
+  SECTION("all orders are about equally likely") {
+    std::map<std::vector<std::uint64_t>, int> counts;
+    Random random;
+    static constexpr int kTotal = 60000;
+    for (int i = 0; i < kTotal; i++) {
+      counts[sampleWithoutReplacement(random, 3, 3)]++;
+    }
+
+    REQUIRE(counts.size() == 6);
+    for (const auto &p : counts) {
+      REQUIRE(std::abs(p.second - (kTotal / 6)) < (kTotal / 60));
+    }
+  }
+}
@@ -1,6 +1,8 @@
 #include <catch2/catch.hpp>
 #include <rapidcheck/catch.h>
 
+#include "detail/Base64.h"
+#include "detail/ParseException.h"
 #include "detail/StringSerialization.h"
 
 #include "util/Generators.h"
@@ -14,4 +16,29 @@ TEST_CASE("stringToReproduceMap") {
          RC_ASSERT(stringToReproduceMap(reproduceMapToString(reproMap)) ==
                    reproMap);
        });
+
+  prop("rejects strings printed before the format was versioned",
+       [](std::unordered_map<std::string, Reproduce> reproMap,
+          const Reproduce &reproduce) {
+         reproMap.emplace("foobar", reproduce);
+         std::vector<std::uint8_t> data;
+         serialize(reproMap, std::back_inserter(data));
+
+         try {
+           stringToReproduceMap(base64Encode(data));
+         } catch (const ParseException &e) {
+           RC_ASSERT(e.message().find("older version") != std::string::npos);
+           RC_SUCCEED("Rejected");
+         }
+         RC_FAIL("Did not reject the string");
+       });
+
+  prop("rejects unknown format versions",
+       [](const std::unordered_map<std::string, Reproduce> &reproMap) {
+         const auto version = *gen::distinctFrom(std::uint8_t(1));
+         auto data = base64Decode(reproduceMapToString(reproMap));
+         data[1] = version;
+         RC_ASSERT_THROWS_AS(stringToReproduceMap(base64Encode(data)),
+                             ParseException);
+       });
 }
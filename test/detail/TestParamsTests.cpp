@@ -16,4 +16,13 @@ TEST_CASE("TestParams") {
   PROP_REPLACE_MEMBER_INEQUAL(TestParams, maxSuccess);
   PROP_REPLACE_MEMBER_INEQUAL(TestParams, maxSize);
   PROP_REPLACE_MEMBER_INEQUAL(TestParams, maxDiscardRatio);
+  PROP_REPLACE_MEMBER_INEQUAL(TestParams, shrinkEngine);
+  PROP_REPLACE_MEMBER_INEQUAL(TestParams, sizeSchedule);
+  PROP_REPLACE_MEMBER_INEQUAL(TestParams, coverageGuided);
+  PROP_REPLACE_MEMBER_INEQUAL(TestParams, failFast);
+  PROP_REPLACE_MEMBER_INEQUAL(TestParams, shardIndex);
+  PROP_REPLACE_MEMBER_INEQUAL(TestParams, shardCount);
+  PROP_REPLACE_MEMBER_INEQUAL(TestParams, caseTimeoutMs);
+  PROP_REPLACE_MEMBER_INEQUAL(TestParams, isolation);
+  PROP_REPLACE_MEMBER_INEQUAL(TestParams, memoryLimitMb);
 }
@@ -2,8 +2,12 @@
 #include <rapidcheck/catch.h>
 
 #include <algorithm>
+#include <cstdlib>
+#include <thread>
 
 #include "rapidcheck/detail/TestListenerAdapter.h"
+#include "detail/Coverage.h"
+#include "detail/Isolation.h"
 #include "detail/Testing.h"
 
 #include "util/Generators.h"
@@ -149,6 +153,40 @@ TEST_CASE("searchProperty") {
          RC_ASSERT(std::count(begin(frequencies), end(frequencies), 0) == 0);
        });
 
+  prop("exponential schedule never decreases size and ends at maxSize",
+       [](TestParams params) {
+         RC_PRE(params.maxSuccess > 1);
+         params.sizeSchedule = SizeSchedule::Exponential;
+
+         std::vector<int> sizes;
+         searchTestable([&] { sizes.push_back(*genSize()); }, params);
+         RC_ASSERT(std::is_sorted(begin(sizes), end(sizes)));
+         RC_ASSERT(sizes.back() == params.maxSize);
+       });
+
+  prop("adaptive schedule only uses sizes up to maxSize",
+       [](TestParams params) {
+         params.sizeSchedule = SizeSchedule::Adaptive;
+         int usedMax = 0;
+         searchTestable([&] { usedMax = std::max(*genSize(), usedMax); },
+                        params);
+         RC_ASSERT(usedMax <= params.maxSize);
+       });
+
+  SECTION("adaptive schedule avoids sizes that are discarded") {
+    TestParams params;
+    params.maxSize = 10;
+    params.maxSuccess = 200;
+    params.maxDiscardRatio = 100;
+    const auto property = [] { RC_PRE(*genSize() >= 5); };
+    const auto linearResult = searchTestable(property, params);
+    params.sizeSchedule = SizeSchedule::Adaptive;
+    const auto adaptiveResult = searchTestable(property, params);
+
+    REQUIRE(adaptiveResult.type == SearchResult::Type::Success);
+    REQUIRE(adaptiveResult.numDiscarded < linearResult.numDiscarded);
+  }
+
   prop("should increase size eventually if enough tests are discarded",
        [](TestParams params) {
          params.maxDiscardRatio = 100;
@@ -275,6 +313,454 @@ Shrinkable<CaseDescription> countdownEven(int start) {
 }
 }
 
+TEST_CASE("sharding") {
+  prop("shards run every shardCount:th case of the unsharded run",
+       [](TestParams params) {
+         params.sizeSchedule =
+             *gen::element(SizeSchedule::Linear, SizeSchedule::Exponential);
+         const auto shardCount = *gen::inRange(1, 6);
+
+         std::vector<std::pair<int, int>> cases;
+         const auto property = [&] {
+           cases.emplace_back(*genSize(), *gen::arbitrary<int>());
+         };
+         searchTestable(property, params);
+         const auto allCases = std::move(cases);
+
+         params.shardCount = shardCount;
+         for (int i = 0; i < shardCount; i++) {
+           params.shardIndex = i;
+           cases.clear();
+           const auto result = searchTestable(property, params);
+
+           std::vector<std::pair<int, int>> expected;
+           for (std::size_t j = i; j < allCases.size(); j += shardCount) {
+             expected.push_back(allCases[j]);
+           }
+           RC_ASSERT(cases == expected);
+           RC_ASSERT(result.numSuccess == static_cast<int>(expected.size()));
+         }
+       });
+
+  prop("shards start from distinct seeds even with discards",
+       [](TestParams params) {
+         params.shardCount = *gen::inRange(1, 6);
+
+         // The value only depends on the Random of the test case
+         bool discarding = false;
+         std::vector<std::uint64_t> values;
+         const auto property = [&] {
+           const auto value = *gen::resize(
+               kNominalSize, gen::arbitrary<std::uint64_t>());
+           values.push_back(value);
+           RC_PRE(!discarding || ((value % 3) != 0));
+         };
+
+         discarding = true;
+         std::vector<std::vector<std::uint64_t>> shardValues;
+         std::size_t numSplits = 0;
+         for (int i = 0; i < params.shardCount; i++) {
+           params.shardIndex = i;
+           values.clear();
+           searchTestable(property, params);
+           if (!values.empty()) {
+             numSplits = std::max(
+                 numSplits,
+                 static_cast<std::size_t>(i) +
+                     ((values.size() - 1) * params.shardCount) + 1);
+           }
+           shardValues.push_back(std::move(values));
+         }
+
+         // Without discards, every test case starts from the next split
+         discarding = false;
+         params.shardCount = 1;
+         params.shardIndex = 0;
+         params.maxSuccess = static_cast<int>(numSplits);
+         values.clear();
+         searchTestable(property, params);
+         const auto allValues = std::move(values);
+
+         for (std::size_t i = 0; i < shardValues.size(); i++) {
+           std::vector<std::uint64_t> expected;
+           for (std::size_t j = 0; j < shardValues[i].size(); j++) {
+             expected.push_back(allValues[i + (j * shardValues.size())]);
+           }
+           RC_ASSERT(shardValues[i] == expected);
+         }
+       });
+
+  prop("failures found by a shard can be reproduced",
+       [](TestParams params) {
+         params.shardCount = *gen::inRange(1, 6);
+         params.shardIndex = *gen::inRange(0, params.shardCount);
+         RC_PRE(params.maxSuccess > params.shardIndex);
+         // Choice shrinking does not record a shrink path to reproduce
+         params.shrinkEngine = ShrinkEngine::Tree;
+         const auto property = toProperty([] {
+           *gen::arbitrary<std::vector<int>>();
+           return false;
+         });
+         const auto result =
+             testProperty(property, TestMetadata(), params, dummyListener);
+
+         FailureResult failure;
+         RC_ASSERT(result.match(failure));
+         const auto reproduced =
+             reproduceProperty(property, *failure.reproduce);
+         FailureResult reproducedFailure;
+         RC_ASSERT(reproduced.match(reproducedFailure));
+         RC_ASSERT(reproducedFailure.counterExample == failure.counterExample);
+       });
+}
+
+TEST_CASE("coverage guidance") {
+  SECTION("finds failures that need several specific values") {
+    std::uint8_t counters[2] = {0, 0};
+    registerCoverageCounters(counters, counters + 2);
+    const auto property = toProperty([&] {
+      const auto digit = gen::resize(kNominalSize, gen::inRange(0, 64));
+      if (*digit == 42) {
+        counters[0]++;
+        if (*digit == 13) {
+          counters[1]++;
+          RC_ASSERT(*digit != 7);
+        }
+      }
+    });
+
+    TestParams params;
+    params.maxSuccess = 100000;
+    params.coverageGuided = true;
+    const auto result =
+        testProperty(property, TestMetadata(), params, dummyListener);
+    unregisterCoverageCounters(counters);
+
+    FailureResult failure;
+    REQUIRE(result.match(failure));
+    REQUIRE(failure.counterExample.size() == 3U);
+    REQUIRE(failure.counterExample[0].second == "42");
+    REQUIRE(failure.counterExample[1].second == "13");
+    REQUIRE(failure.counterExample[2].second == "7");
+  }
+
+  SECTION("failures found by mutation can be reproduced") {
+    std::uint8_t counters[2] = {0, 0};
+    const auto property = toProperty([&] {
+      const auto digit = gen::resize(kNominalSize, gen::inRange(0, 64));
+      if (*digit == 42) {
+        counters[0]++;
+        if (*digit == 13) {
+          counters[1]++;
+          RC_ASSERT(*digit != 7);
+        }
+      }
+    });
+
+    for (const auto disableShrinking : {false, true}) {
+      TestParams params;
+      params.maxSuccess = 100000;
+      params.coverageGuided = true;
+      params.disableShrinking = disableShrinking;
+      registerCoverageCounters(counters, counters + 2);
+      const auto result =
+          testProperty(property, TestMetadata(), params, dummyListener);
+      unregisterCoverageCounters(counters);
+
+      FailureResult failure;
+      REQUIRE(result.match(failure));
+      REQUIRE(!failure.reproduce->choices.empty());
+      const auto reproduced =
+          reproduceProperty(property, *failure.reproduce);
+      FailureResult reproducedFailure;
+      REQUIRE(reproduced.match(reproducedFailure));
+      REQUIRE(reproducedFailure.description == failure.description);
+      REQUIRE(reproducedFailure.counterExample == failure.counterExample);
+    }
+  }
+
+  prop("has no effect without coverage counters",
+       [](TestParams params) {
+         params.coverageGuided = false;
+         auto guidedParams = params;
+         guidedParams.coverageGuided = true;
+
+         const auto property =
+             toProperty([](int x) { RC_ASSERT((x % 100) != 0); });
+         const auto result =
+             searchProperty(property, params, dummyListener);
+         const auto guidedResult =
+             searchProperty(property, guidedParams, dummyListener);
+         RC_ASSERT(result.type == guidedResult.type);
+         RC_ASSERT(result.numSuccess == guidedResult.numSuccess);
+         RC_ASSERT(result.numDiscarded == guidedResult.numDiscarded);
+       });
+}
+
+TEST_CASE("targeted search") {
+  SECTION("finds inputs that exceed the threshold") {
+    const auto property = toProperty([] {
+      const auto x = *gen::resize(kNominalSize, gen::inRange(0, 1000000));
+      RC_TARGET(-std::abs(x - 123456), -100.0);
+    });
+
+    TestParams params;
+    params.maxSuccess = 2000;
+    const auto result =
+        testProperty(property, TestMetadata(), params, dummyListener);
+
+    FailureResult failure;
+    REQUIRE(result.match(failure));
+    REQUIRE(failure.counterExample.size() == 1U);
+    const auto x = std::stoi(failure.counterExample[0].second);
+    REQUIRE(std::abs(x - 123456) < 100);
+  }
+
+  SECTION("failures found by climbing can be reproduced") {
+    const auto property = toProperty([] {
+      const auto x = *gen::resize(kNominalSize, gen::inRange(0, 1000000));
+      RC_TARGET(-std::abs(x - 123456), -100.0);
+    });
+
+    TestParams params;
+    params.maxSuccess = 2000;
+    const auto result =
+        testProperty(property, TestMetadata(), params, dummyListener);
+
+    FailureResult failure;
+    REQUIRE(result.match(failure));
+    REQUIRE(!failure.reproduce->choices.empty());
+    const auto reproduced =
+        reproduceProperty(property, *failure.reproduce);
+    FailureResult reproducedFailure;
+    REQUIRE(reproduced.match(reproducedFailure));
+    REQUIRE(reproducedFailure.counterExample == failure.counterExample);
+  }
+
+  prop("reports the highest target and the test case that reached it",
+       [](const TestParams &params) {
+         RC_PRE(params.maxSuccess > 0);
+         auto highest = std::numeric_limits<int>::min();
+         const auto property = toProperty([&](int x) {
+           highest = std::max(highest, x);
+           RC_TARGET(x);
+         });
+         const auto result =
+             testProperty(property, TestMetadata(), params, dummyListener);
+
+         SuccessResult success;
+         RC_ASSERT(result.match(success));
+         RC_ASSERT(success.target);
+         RC_ASSERT(success.target->value == highest);
+         RC_ASSERT(success.target->example.size() == 1U);
+         RC_ASSERT(success.target->example[0].second ==
+                   "(" + std::to_string(highest) + ")");
+       });
+
+  prop("reports no target if none was reported",
+       [](const TestParams &params) {
+         const auto result = testProperty(
+             toProperty([] {}), TestMetadata(), params, dummyListener);
+
+         SuccessResult success;
+         RC_ASSERT(result.match(success));
+         RC_ASSERT(!success.target);
+       });
+}
+
+TEST_CASE("performance budgets") {
+  SECTION("shrinks to the smallest input that exceeds the budget") {
+    const auto property = toProperty([](const std::vector<bool> &elements) {
+      RC_ASSERT_WITHIN(std::chrono::milliseconds(1),
+                       std::this_thread::sleep_for(std::chrono::microseconds(
+                           200 * elements.size())));
+    });
+
+    const auto result =
+        testProperty(property, TestMetadata(), TestParams(), dummyListener);
+
+    FailureResult failure;
+    REQUIRE(result.match(failure));
+    REQUIRE(failure.counterExample.size() == 1U);
+    const auto numElements =
+        std::count(begin(failure.counterExample[0].second),
+                   end(failure.counterExample[0].second),
+                   ',') +
+        1;
+    REQUIRE(numElements <= 5);
+  }
+}
+
+TEST_CASE("complexity estimation") {
+  SECTION("fails if the runtime grows faster than the bound") {
+    const auto property = toProperty([](const std::vector<bool> &elements) {
+      const auto n = elements.size();
+      RC_ASSERT_COMPLEXITY(
+          Complexity::Linear,
+          n,
+          std::this_thread::sleep_for(std::chrono::microseconds(n * n)));
+    });
+
+    const auto result =
+        testProperty(property, TestMetadata(), TestParams(), dummyListener);
+
+    FailureResult failure;
+    REQUIRE(result.match(failure));
+    REQUIRE(failure.description.find("O(n^2)") != std::string::npos);
+    REQUIRE(failure.counterExample.size() == 1U);
+    // The largest case succeeded on its own so it cannot reproduce the failure
+    REQUIRE(!failure.reproduce);
+  }
+
+  SECTION("reports the complexity if within the bound") {
+    const auto property = toProperty([](const std::vector<bool> &elements) {
+      const auto n = elements.size();
+      RC_ASSERT_COMPLEXITY(
+          Complexity::Linearithmic,
+          n,
+          std::this_thread::sleep_for(std::chrono::microseconds(20 * n)));
+    });
+
+    const auto result =
+        testProperty(property, TestMetadata(), TestParams(), dummyListener);
+
+    SuccessResult success;
+    REQUIRE(result.match(success));
+    REQUIRE(success.complexity);
+    REQUIRE(*success.complexity <= Complexity::Linearithmic);
+  }
+
+  prop("reports no complexity if not measured",
+       [](const TestParams &params) {
+         const auto result = testProperty(
+             toProperty([] {}), TestMetadata(), params, dummyListener);
+
+         SuccessResult success;
+         RC_ASSERT(result.match(success));
+         RC_ASSERT(!success.complexity);
+       });
+}
+
+TEST_CASE("watchesTestCases") {
+  TestParams params;
+  params.caseTimeoutMs = 50;
+
+  SECTION("returns false if there is no timeout") {
+    params.caseTimeoutMs = 0;
+    REQUIRE(!watchesTestCases(params));
+  }
+
+  SECTION("returns true if test cases are not isolated") {
+    params.isolation = CaseIsolation::None;
+    REQUIRE(watchesTestCases(params));
+  }
+
+  SECTION("falls back to watching test cases if isolation is unavailable") {
+    params.isolation = CaseIsolation::Fork;
+    REQUIRE(watchesTestCases(params) == !isolationAvailable());
+#ifdef _WIN32
+    REQUIRE(watchesTestCases(params));
+#endif // _WIN32
+  }
+}
+
+#ifndef _WIN32
+
+TEST_CASE("case timeouts") {
+  SECTION("shrinks isolated test cases to the smallest one that times out") {
+    const auto property = toProperty([](int x) {
+      while (x >= 10) {
+        std::this_thread::sleep_for(std::chrono::milliseconds(10));
+      }
+    });
+
+    TestParams params;
+    params.caseTimeoutMs = 50;
+    params.isolation = CaseIsolation::Fork;
+    const auto result =
+        testProperty(property, TestMetadata(), params, dummyListener);
+
+    FailureResult failure;
+    REQUIRE(result.match(failure));
+    REQUIRE(failure.description == "Test case timed out after 50 ms");
+    REQUIRE(failure.counterExample ==
+            (Example{{"std::tuple<int>", "(10)"}}));
+  }
+}
+
+TEST_CASE("isolation") {
+  SECTION("shrinks test cases that crash to the smallest one that crashes") {
+    const auto property = toProperty([](int x) {
+      if (x >= 10) {
+        std::abort();
+      }
+    });
+
+    TestParams params;
+    params.isolation = CaseIsolation::Fork;
+    const auto result =
+        testProperty(property, TestMetadata(), params, dummyListener);
+
+    FailureResult failure;
+    REQUIRE(result.match(failure));
+    const std::string prefix = "Test case was terminated by SIGABRT";
+    REQUIRE(failure.description.compare(0, prefix.size(), prefix) == 0);
+    REQUIRE(failure.counterExample ==
+            (Example{{"std::tuple<int>", "(10)"}}));
+  }
+}
+
+#endif // _WIN32
+
+TEST_CASE("fail fast") {
+  prop("searchProperty stops if cancelled and failFast is set",
+       [](TestParams params) {
+         params.failFast = true;
+         auto numCases = 0;
+         setTestingCancelled(true);
+         const auto result = searchTestable([&] { numCases++; }, params);
+         setTestingCancelled(false);
+
+         RC_ASSERT(numCases == 0);
+         RC_ASSERT(result.numSuccess == 0);
+         RC_ASSERT(result.type == (params.maxSuccess == 0
+                                       ? SearchResult::Type::Success
+                                       : SearchResult::Type::Cancelled));
+       });
+
+  prop("searchProperty ignores cancellation if failFast is not set",
+       [](const TestParams &params) {
+         setTestingCancelled(true);
+         const auto result = searchTestable([] {}, params);
+         setTestingCancelled(false);
+
+         RC_ASSERT(result.type == SearchResult::Type::Success);
+         RC_ASSERT(result.numSuccess == params.maxSuccess);
+       });
+
+  prop("cancelled search yields error result",
+       [](TestParams params) {
+         RC_PRE(params.maxSuccess > 0);
+         params.failFast = true;
+         setTestingCancelled(true);
+         const auto result = testTestable([] {}, params);
+         setTestingCancelled(false);
+
+         RC_ASSERT(result.is<Error>());
+       });
+
+  prop("failing property cancels testing if failFast is set",
+       [](TestParams params) {
+         RC_PRE(params.maxSuccess > 0);
+         params.failFast = *gen::arbitrary<bool>();
+         testTestable([] { return false; }, params);
+         const auto cancelled = isTestingCancelled();
+         setTestingCancelled(false);
+
+         RC_ASSERT(cancelled == params.failFast);
+       });
+}
+
 TEST_CASE("shrinkTestCase") {
   prop("returns the minimum shrinkable",
        [] {
@@ -340,11 +826,89 @@ TEST_CASE("shrinkTestCase") {
        });
 }
 
+TEST_CASE("shrinkTestCaseChoices") {
+  const auto searchFailure = [](const Property &property) {
+    TestParams params;
+    params.seed = *gen::arbitrary<uint64_t>();
+    params.maxSuccess = 1000;
+    const auto result = searchProperty(property, params, dummyListener);
+    RC_PRE(result.type == SearchResult::Type::Failure);
+    return *result.failure;
+  };
+
+  prop("finds the minimal failing value",
+       [&] {
+         const auto target = *gen::inRange(0, 10000);
+         const auto property = toProperty([=] {
+           RC_ASSERT(*gen::inRange(0, 20000) < target);
+         });
+
+         const auto failure = searchFailure(property);
+         const auto result = shrinkTestCaseChoices(
+             property, failure.random, failure.size, dummyListener);
+         const auto caseDescription = result.first.value();
+         RC_ASSERT(caseDescription.result.type == CaseResult::Type::Failure);
+         RC_ASSERT(caseDescription.example().back().second ==
+                   std::to_string(target));
+
+         // The returned choices replay the final shrink
+         ChoiceSource source(result.second);
+         ChoiceSourceScope scope(source);
+         const auto replayed = property(failure.random, failure.size).value();
+         RC_ASSERT(replayed.example() == caseDescription.example());
+       });
+
+  prop("shrinks through gen::mapcat",
+       [&] {
+         std::vector<int> elements;
+         const auto property = toProperty([&] {
+           elements = *gen::mapcat(gen::inRange(1, 10), [](int n) {
+             return gen::container<std::vector<int>>(n, gen::inRange(0, 100));
+           });
+           RC_ASSERT(std::all_of(begin(elements),
+                                 end(elements),
+                                 [](int x) { return x < 50; }));
+         });
+
+         const auto failure = searchFailure(property);
+         const auto result = shrinkTestCaseChoices(
+             property, failure.random, failure.size, dummyListener);
+         result.first.value();
+         // Lowering the number of elements changes the meaning of the choices
+         // that follow so only the elements themselves are minimal
+         RC_ASSERT(!elements.empty());
+         RC_ASSERT(elements.back() == 50);
+         RC_ASSERT(std::all_of(begin(elements),
+                               end(elements) - 1,
+                               [](int x) { return x == 0; }));
+       });
+
+  prop("calls onShrinkTried for each shrink tried",
+       [&] {
+         const auto property = toProperty([] {
+           const auto x = *gen::inRange(0, 1000);
+           RC_TAG(x);
+           RC_ASSERT(x < 500);
+         });
+
+         const auto failure = searchFailure(property);
+         MockTestListener listener;
+         listener.onShrinkTriedCallback =
+             [&](const CaseDescription &desc, bool accepted) {
+               const auto x = std::stoi(desc.tags.front());
+               RC_ASSERT(!accepted || (x >= 500));
+             };
+         shrinkTestCaseChoices(
+             property, failure.random, failure.size, listener);
+       });
+}
+
 TEST_CASE("testProperty") {
   prop("returns the correct shrink path on a failing case",
        [](TestParams params) {
          RC_PRE(params.maxSuccess > 0);
          params.disableShrinking = false;
+         params.shrinkEngine = ShrinkEngine::Tree;
          const auto evenInteger =
              gen::scale(0.25,
                         gen::suchThat(gen::positive<int>(),
@@ -361,7 +925,7 @@ TEST_CASE("testProperty") {
          const auto numShrinks = (values.first / 2) + (values.second / 2);
          // Every shrink should be the second shrink, thus fill with 1
          const auto expected = std::vector<std::size_t>(numShrinks, 1);
-         RC_ASSERT(failure.reproduce.shrinkPath == expected);
+         RC_ASSERT(failure.reproduce->shrinkPath == expected);
        });
 
   prop("returns a correct counter-example",
@@ -495,6 +1059,23 @@ TEST_CASE("testProperty") {
          RC_ASSERT(success.distribution.empty());
        });
 
+  prop("finds minimal counter-example with choice shrinking",
+       [](TestParams params) {
+         RC_PRE(params.maxSuccess > 0);
+         params.disableShrinking = false;
+         params.shrinkEngine = ShrinkEngine::Choices;
+         const auto result = testTestable([] {
+           const auto elements =
+               *gen::container<std::vector<int>>(gen::inRange(0, 100));
+           RC_ASSERT(elements.size() < 3U);
+         }, params, dummyListener);
+
+         FailureResult failure;
+         RC_PRE(result.match(failure));
+         RC_ASSERT(failure.counterExample.front().second ==
+                   toString(std::vector<int>{0, 0, 0}));
+       });
+
   prop("does not shrink result if disableShrinking is set",
        [](TestParams params) {
          RC_PRE(params.maxSuccess > 0);
@@ -531,7 +1112,8 @@ TEST_CASE("reproduceProperty") {
          FailureResult failure;
          RC_ASSERT(result.match(failure));
 
-         const auto reproduced = reproduceProperty(property, failure.reproduce);
+         const auto reproduced =
+             reproduceProperty(property, *failure.reproduce);
          FailureResult reproducedFailure;
          RC_ASSERT(reproduced.match(reproducedFailure));
 
@@ -0,0 +1,133 @@
+#include <catch2/catch.hpp>
+#include <rapidcheck/catch.h>
+
+#include <atomic>
+#include <thread>
+
+#include "rapidcheck/detail/TestListenerAdapter.h"
+
+#include "detail/Testing.h"
+#include "detail/Watchdog.h"
+
+using namespace rc;
+using namespace rc::detail;
+
+namespace {
+
+TestListenerAdapter dummyListener;
+
+bool waitFor(const std::atomic<bool> &flag) {
+  for (int i = 0; i < 2000; i++) {
+    if (flag) {
+      return true;
+    }
+    std::this_thread::sleep_for(std::chrono::milliseconds(1));
+  }
+  return false;
+}
+
+} // namespace
+
+TEST_CASE("Watchdog") {
+  Watchdog watchdog(std::chrono::milliseconds(10));
+  std::atomic<bool> timedOut(false);
+
+  SECTION("calls the function when a test case times out") {
+    watchdog.start([&] { timedOut = true; });
+    REQUIRE(waitFor(timedOut));
+  }
+
+  SECTION("does not call the function if stopped in time") {
+    // A generous timeout keeps scheduling delays between start and stop from
+    // mattering
+    Watchdog slowWatchdog(std::chrono::seconds(1));
+    for (int i = 0; i < 100; i++) {
+      slowWatchdog.start([&] { timedOut = true; });
+      slowWatchdog.stop();
+    }
+    std::this_thread::sleep_for(std::chrono::milliseconds(1500));
+    REQUIRE_FALSE(timedOut);
+  }
+
+  SECTION("restarts the timeout for every test case") {
+    // The test cases take well below the timeout each but longer than it in
+    // total, a generous timeout keeps scheduling delays from mattering
+    Watchdog slowWatchdog(std::chrono::seconds(1));
+    for (int i = 0; i < 4; i++) {
+      slowWatchdog.start([&] { timedOut = true; });
+      std::this_thread::sleep_for(std::chrono::milliseconds(400));
+      slowWatchdog.stop();
+    }
+    REQUIRE_FALSE(timedOut);
+
+    slowWatchdog.start([&] { timedOut = true; });
+    REQUIRE(waitFor(timedOut));
+  }
+}
+
+TEST_CASE("watchProperty") {
+  Watchdog watchdog(std::chrono::milliseconds(20));
+  std::atomic<bool> released(false);
+  std::vector<Maybe<Reproduce>> timeouts;
+  // Test cases with large values hang until the watchdog releases them
+  const auto property = watchProperty(
+      toProperty([&] {
+        const auto n = *gen::inRange(0, 100);
+        if (n >= 10) {
+          while (!released) {
+            std::this_thread::sleep_for(std::chrono::milliseconds(1));
+          }
+          released = false;
+          RC_FAIL("Hung");
+        }
+      }),
+      watchdog,
+      [&](const Maybe<Reproduce> &reproduce) {
+        timeouts.push_back(reproduce);
+        released = true;
+      });
+
+  SECTION("reports the test case that timed out") {
+    TestParams params;
+    const auto searchResult = searchProperty(property, params, dummyListener);
+    REQUIRE(searchResult.type == SearchResult::Type::Failure);
+    const auto &failure = *searchResult.failure;
+    REQUIRE(timeouts.size() == 1U);
+    REQUIRE(timeouts.back());
+    REQUIRE(timeouts.back()->random == failure.random);
+    REQUIRE(timeouts.back()->size == failure.size);
+    REQUIRE(timeouts.back()->shrinkPath.empty());
+
+    SECTION("including the shrink path of shrinks") {
+      const auto shrinkResult =
+          shrinkTestCase(failure.shrinkable, dummyListener);
+      // Every failure times out and the minimal one is the last one
+      REQUIRE(timeouts.back()->random == failure.random);
+      REQUIRE(timeouts.back()->size == failure.size);
+      REQUIRE(timeouts.back()->shrinkPath == shrinkResult.second);
+    }
+  }
+
+  SECTION("does not report a reproduce for replayed choices") {
+    Random random;
+    Maybe<Choices> choices;
+    while (!choices) {
+      const auto caseRandom = random.split();
+      ChoiceSource recorder;
+      ChoiceSourceScope scope(recorder);
+      if (property(caseRandom, 100).value().result.type ==
+          CaseResult::Type::Failure) {
+        choices = recorder.choices();
+        random = caseRandom;
+      }
+    }
+
+    timeouts.clear();
+    ChoiceSource replayer(*choices);
+    ChoiceSourceScope scope(replayer);
+    property(random, 100).value();
+
+    REQUIRE(timeouts.size() == 1U);
+    REQUIRE_FALSE(timeouts.back());
+  }
+}
@@ -0,0 +1,143 @@
+#include <catch2/catch.hpp>
+#include <rapidcheck/catch.h>
+
+#include "util/ArbitraryRandom.h"
+#include "util/GenUtils.h"
+#include "util/ShrinkableUtils.h"
+
+#include "rapidcheck/gen/Aggregate.h"
+#include "rapidcheck/gen/Tuple.h"
+
+using namespace rc;
+using namespace rc::test;
+
+namespace {
+
+struct Message {
+  int id;
+  std::string body;
+  std::vector<char> payload;
+  bool flag;
+};
+
+struct WideMessage {
+  int f0, f1, f2, f3, f4, f5, f6, f7, f8, f9, f10, f11;
+  long f12, f13, f14, f15, f16, f17, f18, f19, f20, f21, f22, f23;
+};
+
+} // namespace
+
+RC_DERIVE_ARBITRARY(Message, id, body, payload, flag)
+RC_DERIVE_ARBITRARY(WideMessage,
+                    f0,
+                    f1,
+                    f2,
+                    f3,
+                    f4,
+                    f5,
+                    f6,
+                    f7,
+                    f8,
+                    f9,
+                    f10,
+                    f11,
+                    f12,
+                    f13,
+                    f14,
+                    f15,
+                    f16,
+                    f17,
+                    f18,
+                    f19,
+                    f20,
+                    f21,
+                    f22,
+                    f23)
+
+namespace {
+
+using MessageTuple = std::tuple<int, std::string, std::vector<char>, bool>;
+
+Shrinkable<MessageTuple> toTuple(const Shrinkable<Message> &shrinkable) {
+  return shrinkable::map(shrinkable, [](const Message &m) {
+    return std::make_tuple(m.id, m.body, m.payload, m.flag);
+  });
+}
+
+} // namespace
+
+TEST_CASE("gen::aggregate") {
+  prop("is equivalent to gen::tuple of the arbitrary member generators",
+       [](const GenParams &params) {
+         const auto shrinkable = toTuple(
+             gen::aggregate<Message>(
+                 &Message::id, &Message::body, &Message::payload, &Message::flag)(
+                 params.random, params.size));
+         const auto expected =
+             gen::tuple(gen::arbitrary<int>(),
+                        gen::arbitrary<std::string>(),
+                        gen::arbitrary<std::vector<char>>(),
+                        gen::arbitrary<bool>())(params.random, params.size);
+         assertEquivalent(shrinkable, expected);
+       });
+
+  prop("only assigns the given members",
+       [](const GenParams &params) {
+         const auto value =
+             gen::aggregate<Message>(&Message::body)(params.random, params.size)
+                 .value();
+         RC_ASSERT(value.id == 0);
+         RC_ASSERT(value.payload.empty());
+         RC_ASSERT(!value.flag);
+       });
+
+  prop("finds minimum where a member is larger than a value",
+       [](const GenParams &params) {
+         const auto n = *gen::inRange(0, 100);
+         const auto result = searchGen(
+             params.random,
+             params.size,
+             gen::aggregate<Message>(&Message::id, &Message::body),
+             [=](const Message &m) { return m.id > n; });
+         RC_ASSERT(result.id == (n + 1));
+         RC_ASSERT(result.body.empty());
+       });
+
+  prop("generates a value initialized object when no members are given",
+       [](const GenParams &params) {
+         const auto shrinkable =
+             gen::aggregate<Message>()(params.random, params.size);
+         const auto value = shrinkable.value();
+         RC_ASSERT(value.id == 0);
+         RC_ASSERT(value.body.empty());
+         RC_ASSERT(value.payload.empty());
+         RC_ASSERT(!value.flag);
+         RC_ASSERT(!shrinkable.shrinks().next());
+       });
+}
+
+TEST_CASE("RC_DERIVE_ARBITRARY") {
+  prop("uses gen::aggregate with the listed members",
+       [](const GenParams &params) {
+         const auto shrinkable =
+             toTuple(gen::arbitrary<Message>()(params.random, params.size));
+         const auto expected =
+             toTuple(gen::aggregate<Message>(
+                 &Message::id, &Message::body, &Message::payload, &Message::flag)(
+                 params.random, params.size));
+         assertEquivalent(shrinkable, expected);
+       });
+
+  prop("supports many members",
+       [](const GenParams &params) {
+         const auto result = searchGen(
+             params.random,
+             params.size,
+             gen::arbitrary<WideMessage>(),
+             [](const WideMessage &m) { return (m.f0 != 0) && (m.f23 != 0); });
+         RC_ASSERT(result.f0 == 1);
+         RC_ASSERT(result.f11 == 0);
+         RC_ASSERT(result.f12 == 0);
+         RC_ASSERT(result.f23 == 1);
+       });
+}
@@ -0,0 +1,77 @@
+#include <catch2/catch.hpp>
+#include <rapidcheck/catch.h>
+
+#include <algorithm>
+#include <cstdlib>
+#include <map>
+#include <numeric>
+
+#include "Common.h"
+
+using namespace rc;
+using namespace rc::test;
+
+TEST_CASE("gen::permutationOf") {
+  prop("generates permutations of the given container",
+       [](const GenParams &params, const std::vector<int> &elements) {
+         auto sorted = elements;
+         std::sort(begin(sorted), end(sorted));
+         onAnyPath(gen::permutationOf(elements)(params.random, params.size),
+                   [&](const Shrinkable<std::vector<int>> &value,
+                       const Shrinkable<std::vector<int>> &shrink) {
+                     auto permutation = value.value();
+                     std::sort(begin(permutation), end(permutation));
+                     RC_ASSERT(permutation == sorted);
+                   });
+       });
+
+  prop("works with other containers",
+       [](const GenParams &params, const std::string &str) {
+         auto permutation =
+             gen::permutationOf(str)(params.random, params.size).value();
+         RC_ASSERT(std::is_permutation(
+             begin(permutation), end(permutation), begin(str)));
+       });
+
+  prop("first shrink is the original order",
+       [](const GenParams &params) {
+         const auto n = *gen::inRange(2, 20);
+         std::vector<int> elements(n);
+         std::iota(begin(elements), end(elements), 0);
+         const auto shrinkable =
+             gen::permutationOf(elements)(params.random, params.size);
+         RC_PRE(shrinkable.value() != elements);
+         RC_ASSERT(shrinkable.shrinks().next()->value() == elements);
+       });
+
+  prop("finds minimal permutation where first element is not the smallest",
+       [](const GenParams &params) {
+         const auto n = *gen::inRange(2, 50);
+         std::vector<int> elements(n);
+         std::iota(begin(elements), end(elements), 0);
+         const auto result =
+             searchGen(params.random,
+                       params.size,
+                       gen::permutationOf(elements),
+                       [](const std::vector<int> &p) { return p[0] != 0; });
+
+         auto expected = elements;
+         std::swap(expected[0], expected[1]);
+         RC_ASSERT(result == expected);
+       });
+
+  SECTION("all permutations are about equally likely") {
+    const auto gen = gen::permutationOf(std::vector<int>{1, 2, 3});
+    std::map<std::vector<int>, int> counts;
+    Random random;
+    static constexpr int kTotal = 60000;
+    for (int i = 0; i < kTotal; i++) {
+      counts[gen(random.split(), kNominalSize).value()]++;
+    }
+
+    REQUIRE(counts.size() == 6);
+    for (const auto &p : counts) {
+      REQUIRE(std::abs(p.second - (kTotal / 6)) < (kTotal / 60));
+    }
+  }
+}
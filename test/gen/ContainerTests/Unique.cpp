@@ -177,3 +177,99 @@ TEST_CASE("gen::unique") {
               RC_SEQUENCE_CONTAINERS(int),
               std::basic_string<int>>();
 }
+
+namespace {
+
+struct UniqueInRangeProperties {
+  template <typename T>
+  static void exec() {
+    templatedProp<T>(
+        "generated values are unique and in range",
+        [](const GenParams &params) {
+          const auto min = *gen::inRange(-1000, 1000);
+          const auto max = min + *gen::inRange(1, 100);
+          const auto gen = gen::uniqueInRange<T>(min, max);
+          onAnyPath(
+              gen(params.random, params.size),
+              [=](const Shrinkable<T> &value, const Shrinkable<T> &shrink) {
+                const auto v = value.value();
+                std::set<int> s(begin(v), end(v));
+                RC_ASSERT(s.size() ==
+                          std::size_t(std::distance(begin(v), end(v))));
+                for (const auto x : v) {
+                  RC_ASSERT(x >= min);
+                  RC_ASSERT(x < max);
+                }
+              });
+        });
+
+    templatedProp<T>(
+        "generated value always has the requested number of elements",
+        [](const GenParams &params) {
+          const auto count = *gen::inRange<std::size_t>(0, 10);
+          const auto gen = gen::uniqueInRange<T>(count, 0, 10);
+          onAnyPath(
+              gen(params.random, params.size),
+              [=](const Shrinkable<T> &value, const Shrinkable<T> &shrink) {
+                const auto v = value.value();
+                RC_ASSERT(count ==
+                          std::size_t(std::distance(begin(v), end(v))));
+              });
+        });
+
+    templatedProp<T>(
+        "can fill the entire range",
+        [](const GenParams &params) {
+          const auto n = *gen::inRange(0, 2000);
+          const auto v =
+              gen::uniqueInRange<T>(n, 0, n)(params.random, params.size)
+                  .value();
+          std::set<int> s(begin(v), end(v));
+          RC_ASSERT(s.size() == std::size_t(n));
+        });
+
+    templatedProp<T>(
+        "never has more elements than the range",
+        [](const GenParams &params) {
+          const auto n = *gen::inRange(1, 5);
+          const auto v = gen::uniqueInRange<T>(0, n)(params.random, 100).value();
+          RC_ASSERT(std::size_t(std::distance(begin(v), end(v))) <=
+                    std::size_t(n));
+        });
+
+    templatedProp<T>(
+        "throws if count is larger than the range",
+        [](const GenParams &params) {
+          const auto n = *gen::inRange(1, 100);
+          const auto shrinkable =
+              gen::uniqueInRange<T>(n + 1, 0, n)(params.random, params.size);
+          RC_ASSERT_THROWS_AS(shrinkable.value(), GenerationFailure);
+        });
+
+    templatedProp<T>(
+        "finds minimum where at least two elements must have values greater "
+        "than a certain value",
+        [](const GenParams &params) {
+          const auto gen = gen::uniqueInRange<T>(0, 1000);
+          const auto target = *gen::inRange(0, 10);
+          const auto result = searchGen(
+              params.random,
+              params.size,
+              gen,
+              [=](T elements) {
+                return std::count_if(begin(elements),
+                                     end(elements),
+                                     [=](int x) { return x >= target; }) >= 2;
+              });
+
+          RC_ASSERT((std::set<int>(begin(result), end(result)) ==
+                     std::set<int>{target + 1, target}));
+        });
+  }
+};
+
+} // namespace
+
+TEST_CASE("gen::uniqueInRange") {
+  forEachType<UniqueInRangeProperties, RC_SEQUENCE_CONTAINERS(int)>();
+}
@@ -1,6 +1,7 @@
 #include <catch2/catch.hpp>
 #include <rapidcheck/catch.h>
 
+#include <cmath>
 #include <numeric>
 
 #include "rapidcheck/gen/Arbitrary.h"
@@ -174,6 +175,113 @@ TEST_CASE("arbitrary reals") {
 
 namespace {
 
+template <typename T, typename Predicate>
+bool generatesSome(const Gen<T> &gen, const Random &random, Predicate pred) {
+  Random r(random);
+  for (int i = 0; i < 10000; i++) {
+    if (pred(gen(r.split(), kNominalSize).value())) {
+      return true;
+    }
+  }
+  return false;
+}
+
+template <typename T>
+bool isDenormal(T x) {
+  return (x != 0) && (std::abs(x) < std::numeric_limits<T>::min());
+}
+
+struct RealGenProperties {
+  template <typename T>
+  static void exec() {
+    templatedProp<T>("arbitrary never generates NaN or infinity",
+                     [](const GenParams &params) {
+                       const auto shrinkable =
+                           gen::arbitrary<T>()(params.random, params.size);
+                       onAnyPath(shrinkable,
+                                 [](const Shrinkable<T> &value,
+                                    const Shrinkable<T> &shrink) {
+                                   RC_ASSERT(std::isfinite(value.value()));
+                                 });
+                     });
+
+    templatedProp<T>(
+        "arbitrary never generates denormals or extreme values",
+        [](const GenParams &params) {
+          const auto x =
+              gen::arbitrary<T>()(params.random, params.size).value();
+          RC_ASSERT(!isDenormal(x));
+          RC_ASSERT(std::abs(x) < std::numeric_limits<T>::max() / 2);
+        });
+
+    templatedProp<T>(
+        "generates all kinds of special values",
+        [](const Random &random) {
+          const auto gen = gen::real<T>();
+          RC_ASSERT(
+              generatesSome(gen, random, [](T x) { return std::isnan(x); }));
+          RC_ASSERT(generatesSome(gen, random, [](T x) {
+            return x == std::numeric_limits<T>::infinity();
+          }));
+          RC_ASSERT(generatesSome(gen, random, [](T x) {
+            return x == -std::numeric_limits<T>::infinity();
+          }));
+          RC_ASSERT(generatesSome(gen, random, isDenormal<T>));
+          RC_ASSERT(generatesSome(gen, random, [](T x) {
+            return x == std::numeric_limits<T>::max();
+          }));
+        });
+
+    templatedProp<T>("zero rates yield only normal values",
+                     [](const GenParams &params) {
+                       gen::RealOptions options;
+                       options.nanRate = 0.0;
+                       options.infinityRate = 0.0;
+                       options.denormalRate = 0.0;
+                       options.extremeRate = 0.0;
+                       const auto x =
+                           gen::real<T>(options)(params.random, params.size)
+                               .value();
+                       RC_ASSERT(std::isfinite(x));
+                       RC_ASSERT(!isDenormal(x));
+                     });
+
+    templatedProp<T>("only NaN if nanRate is 1",
+                     [](const Random &random) {
+                       gen::RealOptions options;
+                       options.nanRate = 1.0;
+                       options.infinityRate = 0.0;
+                       options.denormalRate = 0.0;
+                       options.extremeRate = 0.0;
+                       RC_ASSERT(std::isnan(gen::real<T>(options)(
+                           random, kNominalSize).value()));
+                     });
+
+    templatedProp<T>("throws if rates are invalid",
+                     [](const GenParams &params) {
+                       gen::RealOptions options;
+                       options.denormalRate =
+                           *gen::element(-0.5, 1.5, 0.99);
+                       const auto shrinkable =
+                           gen::real<T>(options)(params.random, params.size);
+                       RC_ASSERT_THROWS_AS(shrinkable.value(),
+                                           GenerationFailure);
+                     });
+
+    templatedProp<T>("zero size always yields zero",
+                     [](const Random &random) {
+                       RC_ASSERT(gen::real<T>()(random, 0) ==
+                                 shrinkable::just(static_cast<T>(0)));
+                     });
+  }
+};
+
+} // namespace
+
+TEST_CASE("gen::real") { forEachType<RealGenProperties, RC_REAL_TYPES>(); }
+
+namespace {
+
 struct InRangeProperties {
   template <typename T>
   static void exec() {
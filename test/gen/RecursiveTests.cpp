@@ -0,0 +1,139 @@
+#include <catch2/catch.hpp>
+#include <rapidcheck/catch.h>
+
+#include "rapidcheck/gen/Recursive.h"
+
+#include "util/GenUtils.h"
+#include "util/ShrinkableUtils.h"
+
+using namespace rc;
+using namespace rc::test;
+
+namespace {
+
+struct Tree {
+  int value;
+  bool inner;
+  std::vector<Tree> children;
+};
+
+void showValue(const Tree &tree, std::ostream &os) {
+  os << (tree.inner ? "Node" : "Leaf") << "(" << tree.value;
+  for (const auto &child : tree.children) {
+    os << ", ";
+    showValue(child, os);
+  }
+  os << ")";
+}
+
+bool operator==(const Tree &lhs, const Tree &rhs) {
+  return (lhs.value == rhs.value) && (lhs.inner == rhs.inner) &&
+      (lhs.children == rhs.children);
+}
+
+std::size_t countInner(const Tree &tree) {
+  std::size_t n = tree.inner ? 1 : 0;
+  for (const auto &child : tree.children) {
+    n += countInner(child);
+  }
+  return n;
+}
+
+bool anyLeaf(const Tree &tree, const std::function<bool(int)> &pred) {
+  if (!tree.inner) {
+    return pred(tree.value);
+  }
+  for (const auto &child : tree.children) {
+    if (anyLeaf(child, pred)) {
+      return true;
+    }
+  }
+  return false;
+}
+
+Gen<Tree> genTree(Gen<std::size_t> arity) {
+  return gen::recursive(
+      gen::map(gen::arbitrary<int>(),
+               [](int x) { return Tree{x, false, {}}; }),
+      std::move(arity),
+      [](std::vector<Tree> children) {
+        return gen::map(gen::arbitrary<int>(), [=](int x) {
+          return Tree{x, true, children};
+        });
+      });
+}
+
+} // namespace
+
+TEST_CASE("gen::recursive") {
+  prop("number of inner nodes never exceeds size",
+       [](const GenParams &params) {
+         const auto maxArity = *gen::inRange<std::size_t>(0, 10);
+         const auto gen = genTree(gen::inRange<std::size_t>(0, maxArity + 1));
+         onAnyPath(gen(params.random, params.size),
+                   [&](const Shrinkable<Tree> &value,
+                       const Shrinkable<Tree> &shrink) {
+                     RC_ASSERT(countInner(value.value()) <=
+                               std::size_t(params.size));
+                   });
+       });
+
+  prop("inner nodes have the generated number of children",
+       [](const GenParams &params) {
+         const auto arity = *gen::inRange<std::size_t>(0, 10);
+         const auto tree =
+             genTree(gen::just(arity))(params.random, params.size).value();
+         std::function<void(const Tree &)> check = [&](const Tree &node) {
+           if (node.inner) {
+             RC_ASSERT(node.children.size() == arity);
+           }
+           for (const auto &child : node.children) {
+             check(child);
+           }
+         };
+         check(tree);
+       });
+
+  prop("zero size yields a leaf",
+       [](const Random &random) {
+         RC_ASSERT(!genTree(gen::just<std::size_t>(2))(random, 0).value().inner);
+       });
+
+  prop("uses the whole budget when there are children",
+       [] {
+         const auto size = *gen::inRange(0, 200);
+         // With a single child, the tree is a list of inner nodes
+         const auto gen = genTree(gen::just<std::size_t>(1));
+         std::size_t maxInner = 0;
+         Random random;
+         for (int i = 0; i < 100; i++) {
+           maxInner = std::max(maxInner,
+                               countInner(gen(random.split(), size).value()));
+         }
+         RC_ASSERT(maxInner >= std::size_t(size / 2));
+       });
+
+  prop("finds a single leaf when a property depends on a leaf",
+       [](const GenParams &params) {
+         const auto target = *gen::inRange(0, 100);
+         const auto gen = genTree(gen::inRange<std::size_t>(0, 4));
+         const auto result =
+             searchGen(params.random, params.size, gen, [=](const Tree &t) {
+               return anyLeaf(t, [=](int x) { return x >= target; });
+             });
+         RC_ASSERT(result == (Tree{target, false, {}}));
+       });
+
+  prop("accepts mutable callables",
+       [](const GenParams &params) {
+         auto numCalls = 0;
+         const auto gen = gen::recursive(
+             gen::just(0),
+             gen::just<std::size_t>(1),
+             [=](std::vector<int> children) mutable {
+               numCalls++;
+               return gen::just(children.front() + 1);
+             });
+         RC_ASSERT(gen(params.random, params.size).value() >= 0);
+       });
+}
@@ -145,6 +145,32 @@ TEST_CASE("gen::weightedElement") {
     const auto shrinkable = gen(Random(), 0);
     REQUIRE_THROWS_AS(shrinkable.value(), GenerationFailure);
   }
+
+  SECTION("large weight tables") {
+    // Large tables use an alias table rather than a binary search
+    const auto genLarge = gen::weightedElement<int>({
+        {1, 1},  {1, 1},  {1, 1},  {1, 1},  {1, 1},  {1, 1},  {1, 1},
+        {1, 1},  {1, 1},  {1, 1},  {1, 1},  {1, 1},  {1, 1},  {1, 1},
+        {1, 1},  {1, 1},  {1, 1},  {1, 1},  {1, 1},  {1, 1},  {1, 1},
+        {1, 1},  {1, 1},  {1, 1},  {1, 1},  {1, 1},  {1, 1},  {1, 1},
+        {1, 1},  {1, 1},  {1, 1},  {1, 1},  {0, 2},  {0, 2},  {0, 2},
+        {0, 2},  {0, 2},  {0, 2},  {0, 2},  {0, 2},  {0, 2},  {0, 2},
+        {0, 2},  {0, 2},  {0, 2},  {0, 2},  {0, 2},  {0, 2},  {0, 2},
+        {0, 2},  {0, 2},  {0, 2},  {0, 2},  {0, 2},  {0, 2},  {0, 2},
+        {0, 2},  {0, 2},  {0, 2},  {0, 2},  {0, 2},  {0, 2},  {0, 2},
+        {96, 0}});
+
+    prop("respects weights",
+         [&](const GenParams &params) {
+           const auto p = probabilityOf(0, genLarge, params);
+           RC_ASSERT(std::abs(p - 0.75) < 0.03);
+         });
+
+    prop("zero weighted elements are never generated",
+         [&](const GenParams &params) {
+           RC_ASSERT(genLarge(params.random, params.size).value() != 2);
+         });
+  }
 }
 
 namespace {
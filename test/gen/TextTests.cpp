@@ -1,6 +1,9 @@
 #include <catch2/catch.hpp>
 #include <rapidcheck/catch.h>
 
+#include <functional>
+#include <regex>
+
 #include "rapidcheck/gen/Text.h"
 
 #include "util/GenUtils.h"
@@ -90,3 +93,333 @@ struct StringProperties {
 TEST_CASE("gen::string") {
   forEachType<StringProperties, std::string, std::wstring>();
 }
+
+TEST_CASE("gen::regex") {
+  static const auto genPattern = gen::element<std::string>(
+      "",
+      "abc",
+      "a*",
+      "(ab|cd)+e?",
+      "[a-z]+@[a-z]+\\.(com|org)",
+      "\\d{3}-\\d{2,4}",
+      "[^a-z]{1,5}",
+      "(x(y|z)*)*",
+      "\\w+\\s\\W?",
+      ".{2,}",
+      "-?(0|[1-9][0-9]*)(\\.[0-9]+)?");
+
+  prop("generated strings match the pattern",
+       [](const GenParams &params) {
+         const auto pattern = *genPattern;
+         const std::regex re(pattern);
+         const auto value =
+             gen::regex(pattern)(params.random, params.size).value();
+         RC_ASSERT(std::regex_match(value, re));
+       });
+
+  prop("shrinks match the pattern",
+       [](const GenParams &params) {
+         const auto pattern = *genPattern;
+         const std::regex re(pattern);
+         const auto shrinkable =
+             gen::regex(pattern)(params.random, std::min(params.size, 20));
+         onAnyPath(shrinkable,
+                   [&](const Shrinkable<std::string> &value,
+                       const Shrinkable<std::string> &shrink) {
+                     RC_ASSERT(std::regex_match(shrink.value(), re));
+                   });
+       });
+
+  prop("size limits the length of unbounded repetitions",
+       [](const GenParams &params) {
+         const auto value = gen::regex("(ab)*")(params.random, params.size)
+                                .value();
+         RC_ASSERT(value.size() <= std::size_t(params.size + 1));
+       });
+
+  prop("finds minimum where string must be longer than a certain length",
+       [](const GenParams &params) {
+         const auto n = *gen::inRange(0, 10);
+         const auto result = searchGen(
+             params.random,
+             params.size,
+             gen::regex("[a-z]+@[a-z]+\\.(com|org)"),
+             [=](const std::string &x) { return x.size() > std::size_t(n); });
+         const std::string minimal = "a@a.com";
+         RC_ASSERT(result.size() ==
+                   std::max(minimal.size(), std::size_t(n + 1)));
+         RC_ASSERT(std::regex_match(result,
+                                    std::regex("a+@a+\\.com")));
+       });
+
+  prop("fails on invalid patterns",
+       [](const GenParams &params) {
+         const auto pattern = *gen::element<std::string>(
+             "(", "a)", "*", "[b-a]", "a{2,1}", "[]", "\\q");
+         const auto shrinkable = gen::regex(pattern)(params.random, params.size);
+         RC_ASSERT_THROWS_AS(shrinkable.value(), GenerationFailure);
+       });
+
+  prop("fails on patterns with nested counts that require too much",
+       [](const GenParams &params) {
+         const auto pattern = *gen::element<std::string>(
+             "(a{1000}){1000}",
+             "(a{100000}){100000}",
+             "((a?){1000}b){1000}",
+             "(a|b{100000}){100}");
+         const auto shrinkable = gen::regex(pattern)(params.random, params.size);
+         RC_ASSERT_THROWS_AS(shrinkable.value(), GenerationFailure);
+       });
+
+  prop("accepts large counts that are not nested",
+       [](const GenParams &params) {
+         const auto value =
+             gen::regex("a{100000}")(params.random, params.size).value();
+         RC_ASSERT(value == std::string(100000, 'a'));
+       });
+}
+
+namespace {
+
+// Decodes UTF-8, returns false if `str` is not valid UTF-8.
+bool decodeUtf8(const std::string &str, std::u32string &out) {
+  std::size_t i = 0;
+  while (i < str.size()) {
+    const auto b = static_cast<unsigned char>(str[i]);
+    std::size_t n;
+    char32_t c;
+    if (b < 0x80) {
+      n = 1;
+      c = b;
+    } else if ((b & 0xE0) == 0xC0) {
+      n = 2;
+      c = b & 0x1F;
+    } else if ((b & 0xF0) == 0xE0) {
+      n = 3;
+      c = b & 0x0F;
+    } else if ((b & 0xF8) == 0xF0) {
+      n = 4;
+      c = b & 0x07;
+    } else {
+      return false;
+    }
+
+    if ((i + n) > str.size()) {
+      return false;
+    }
+    for (std::size_t j = 1; j < n; j++) {
+      const auto cont = static_cast<unsigned char>(str[i + j]);
+      if ((cont & 0xC0) != 0x80) {
+        return false;
+      }
+      c = (c << 6) | (cont & 0x3F);
+    }
+
+    static const char32_t minValue[] = {0, 0, 0x80, 0x800, 0x10000};
+    if ((c < minValue[n]) || (c > 0x10FFFF) || ((c >= 0xD800) && (c <= 0xDFFF))) {
+      return false;
+    }
+    out.push_back(c);
+    i += n;
+  }
+
+  return true;
+}
+
+std::u32string decodeUtf16(const std::u16string &str) {
+  std::u32string out;
+  for (std::size_t i = 0; i < str.size(); i++) {
+    const char32_t c = str[i];
+    if ((c >= 0xD800) && (c <= 0xDBFF)) {
+      RC_ASSERT((i + 1) < str.size());
+      const char32_t low = str[++i];
+      RC_ASSERT((low >= 0xDC00) && (low <= 0xDFFF));
+      out.push_back(0x10000 + ((c - 0xD800) << 10) + (low - 0xDC00));
+    } else {
+      RC_ASSERT(!((c >= 0xDC00) && (c <= 0xDFFF)));
+      out.push_back(c);
+    }
+  }
+  return out;
+}
+
+bool charsetContains(const gen::Charset &charset, char32_t c) {
+  for (std::size_t i = 0; i < charset.size(); i++) {
+    if (charset[i] == c) {
+      return true;
+    }
+  }
+  return false;
+}
+
+bool isControl(char32_t c) { return (c < 0x20) || ((c >= 0x7F) && (c < 0xA0)); }
+
+struct CharsetOracle {
+  gen::Charset charset;
+  std::function<bool(char32_t)> contains;
+};
+
+Gen<CharsetOracle> genCharsetOracle() {
+  return gen::element(
+      CharsetOracle{gen::Charset::asciiPrintable(),
+                    [](char32_t c) { return (c >= ' ') && (c <= '~'); }},
+      CharsetOracle{gen::Charset::plane(0),
+                    [](char32_t c) {
+                      return (c < 0x10000) && !isControl(c) &&
+                          !((c >= 0xD800) && (c <= 0xDFFF));
+                    }},
+      CharsetOracle{gen::Charset::plane(1),
+                    [](char32_t c) { return (c >= 0x10000) && (c < 0x20000); }},
+      CharsetOracle{gen::Charset::unicode(),
+                    [](char32_t c) {
+                      return (c <= 0x10FFFF) && !isControl(c) &&
+                          !((c >= 0xD800) && (c <= 0xDFFF));
+                    }},
+      CharsetOracle{gen::Charset::of(U"ab\u00E5"), [](char32_t c) {
+                      return (c == 'a') || (c == 'b') || (c == 0xE5);
+                    }});
+}
+
+} // namespace
+
+TEST_CASE("gen::Charset") {
+  SECTION("skips surrogates and values out of range") {
+    const gen::Charset charset({{0xD7FE, 0xE001}, {0x10FFFE, 0x110005}});
+    REQUIRE(charset.size() == 6);
+    REQUIRE(charset[0] == 0xD7FE);
+    REQUIRE(charset[1] == 0xD7FF);
+    REQUIRE(charset[2] == 0xE000);
+    REQUIRE(charset[3] == 0xE001);
+    REQUIRE(charset[4] == 0x10FFFE);
+    REQUIRE(charset[5] == 0x10FFFF);
+  }
+
+  SECTION("ranges where first > second are empty") {
+    REQUIRE(gen::Charset({{'b', 'a'}}).size() == 0);
+  }
+
+  SECTION("of contains exactly the given characters in order") {
+    const std::u32string chars = U"xyz\u00E5\U0001F600";
+    const auto charset = gen::Charset::of(chars);
+    REQUIRE(charset.size() == chars.size());
+    for (std::size_t i = 0; i < chars.size(); i++) {
+      REQUIRE(charset[i] == chars[i]);
+    }
+  }
+
+  SECTION("of only includes repeated characters once") {
+    const auto charset = gen::Charset::of(U"abacb");
+    REQUIRE(charset.size() == 3);
+    REQUIRE(charset[0] == 'a');
+    REQUIRE(charset[1] == 'b');
+    REQUIRE(charset[2] == 'c');
+  }
+
+  SECTION("asciiPrintable") {
+    const auto charset = gen::Charset::asciiPrintable();
+    REQUIRE(charset.size() == 95);
+    REQUIRE(charset[0] == 'a');
+    for (char32_t c = ' '; c <= '~'; c++) {
+      REQUIRE(charsetContains(charset, c));
+    }
+  }
+
+  SECTION("unicode contains all scalar values except control characters") {
+    const auto charset = gen::Charset::unicode();
+    REQUIRE(charset.size() == (0x110000 - 0x800 - 0x20 - 0x21));
+    REQUIRE(charset[0] == 'a');
+    REQUIRE(charset[charset.size() - 1] == 0x10FFFF);
+  }
+
+  SECTION("plane") {
+    const auto charset = gen::Charset::plane(1);
+    REQUIRE(charset.size() == 0x10000);
+    REQUIRE(charset[0] == 0x10000);
+    REQUIRE(charset[0xFFFF] == 0x1FFFF);
+    REQUIRE(gen::Charset::plane(17).size() == 0);
+  }
+}
+
+TEST_CASE("gen::string(Charset)") {
+  static const auto genOracle = genCharsetOracle();
+
+  prop("generates valid UTF-8 with code points from the charset",
+       [](const GenParams &params) {
+         const auto oracle = *genOracle;
+         const auto value =
+             gen::string<std::string>(oracle.charset)(params.random, params.size)
+                 .value();
+         std::u32string decoded;
+         RC_ASSERT(decodeUtf8(value, decoded));
+         RC_ASSERT(decoded.size() <= std::size_t(params.size));
+         for (const auto c : decoded) {
+           RC_ASSERT(oracle.contains(c));
+         }
+       });
+
+  prop("generates valid UTF-16 with code points from the charset",
+       [](const GenParams &params) {
+         const auto oracle = *genOracle;
+         const auto value =
+             gen::string<std::u16string>(oracle.charset)(params.random, params.size)
+                 .value();
+         for (const auto c : decodeUtf16(value)) {
+           RC_ASSERT(oracle.contains(c));
+         }
+       });
+
+  prop("generates UTF-32 with code points from the charset",
+       [](const GenParams &params) {
+         const auto oracle = *genOracle;
+         const auto value =
+             gen::string<std::u32string>(oracle.charset)(params.random, params.size)
+                 .value();
+         RC_ASSERT(value.size() <= std::size_t(params.size));
+         for (const auto c : value) {
+           RC_ASSERT(oracle.contains(c));
+         }
+       });
+
+  prop("code points outside of the BMP are encoded as four bytes",
+       [](const GenParams &params) {
+         const auto value = gen::string<std::string>(gen::Charset::plane(1))(
+                                params.random, params.size)
+                                .value();
+         std::u32string decoded;
+         RC_ASSERT(decodeUtf8(value, decoded));
+         RC_ASSERT(value.size() == (decoded.size() * 4));
+       });
+
+  prop("finds minimal string of a certain length",
+       [](const GenParams &params) {
+         const auto charset = (*genOracle).charset;
+         const auto n = *gen::inRange(0, params.size + 1);
+         const auto result = searchGen(
+             params.random,
+             params.size,
+             gen::string<std::u32string>(charset),
+             [=](const std::u32string &x) { return x.size() >= std::size_t(n); });
+         RC_ASSERT(result == std::u32string(n, charset[0]));
+       });
+
+  prop("generates empty strings for negative sizes",
+       [](const GenParams &params) {
+         const auto size = *gen::inRange(-1000, 0);
+         const auto value = gen::string<std::string>(gen::Charset::of(U"a"))(
+                                params.random, size)
+                                .value();
+         RC_ASSERT(value.empty());
+       });
+
+  prop("fails for empty charset unless the string is empty",
+       [](const GenParams &params) {
+         const auto shrinkable =
+             gen::string<std::string>(gen::Charset(
+                 std::vector<gen::Charset::Range>()))(params.random,
+                                                      params.size);
+         try {
+           RC_ASSERT(shrinkable.value().empty());
+         } catch (const GenerationFailure &) {
+         }
+       });
+}
@@ -134,4 +134,20 @@ TEST_CASE("gen::tuple") {
         RC_ASSERT(result.first ==
                   std::make_tuple(target + 1, target, target + 1));
       });
+
+  prop("finds minimum in wide tuples",
+       [](const GenParams &params) {
+         const auto n = *gen::inRange(0, 50);
+         const auto g = gen::inRange(0, 100);
+         const auto result = searchGen(
+             params.random,
+             params.size,
+             gen::tuple(g, g, g, g, g, g, g, g, g, g, g, g),
+             [=](const std::tuple<int, int, int, int, int, int, int, int, int,
+                                  int, int, int> &x) {
+               return (std::get<0>(x) > n) && (std::get<11>(x) > n);
+             });
+         RC_ASSERT(result == std::make_tuple(
+                                 n + 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, n + 1));
+       });
 }
@@ -3,6 +3,7 @@
 
 #include <algorithm>
 #include <numeric>
+#include <stdexcept>
 
 #include "util/Predictable.h"
 #include "util/GenUtils.h"
@@ -12,6 +13,8 @@
 #include "rapidcheck/shrinkable/Operations.h"
 #include "rapidcheck/seq/Operations.h"
 
+#include "gen/detail/IngredientObserver.h"
+
 using namespace rc;
 using namespace rc::test;
 using namespace rc::gen::detail;
@@ -226,6 +229,44 @@ TEST_CASE("execRaw") {
     REQUIRE(value.second.ingredients.empty());
   }
 
+  SECTION("records generators that fail without running them again") {
+    auto numCalls = 0;
+    const auto failing = Gen<int>([&](const Random &, int) -> Shrinkable<int> {
+      numCalls++;
+      throw std::runtime_error("failed");
+    });
+    const auto value = execRaw([&] {
+                         try {
+                           *failing;
+                         } catch (const std::runtime_error &) {
+                         }
+                         return 0;
+                       })(Random(), 0)
+                           .value();
+
+    REQUIRE(numCalls == 1);
+    REQUIRE(value.second.ingredients.size() == 1U);
+    REQUIRE_THROWS_AS(value.second.ingredients.front().value(),
+                      std::runtime_error);
+  }
+
+  SECTION("reports added ingredients to the bound observer") {
+    std::vector<int> observed;
+    rc::detail::ImplicitParam<param::CurrentIngredientObserver> letObserver(
+        [&](const Recipe::Ingredient &ingredient) {
+          observed.push_back(ingredient.shrinkable.value().get<int>());
+        });
+
+    const auto gen = execRaw([] {
+      *gen::just(1);
+      // Nested generators have their own handler which is not observed
+      return *gen::exec([] { return *gen::just(2) + *gen::just(3); });
+    });
+    const auto value = gen(Random(), 0).value();
+
+    REQUIRE(observed == std::vector<int>({1, 5}));
+  }
+
   prop("disallows nested use of operator*",
        [](const GenParams &params) {
          const auto gen = execRaw([] {
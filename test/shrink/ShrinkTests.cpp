@@ -1,7 +1,10 @@
 #include <catch2/catch.hpp>
 #include <rapidcheck/catch.h>
 
+#include <algorithm>
 #include <cctype>
+#include <cmath>
+#include <limits>
 
 #include "rapidcheck/shrink/Shrink.h"
 #include "rapidcheck/seq/Operations.h"
@@ -155,6 +158,65 @@ struct ShrinkTowardsProperties {
 
 } // namespace
 
+namespace {
+
+std::size_t inversions(const std::vector<int> &elements) {
+  std::size_t n = 0;
+  for (std::size_t i = 0; i < elements.size(); i++) {
+    for (std::size_t j = i + 1; j < elements.size(); j++) {
+      if (elements[j] < elements[i]) {
+        n++;
+      }
+    }
+  }
+  return n;
+}
+
+} // namespace
+
+TEST_CASE("shrink::towardsSorted") {
+  prop("first tries the sorted container",
+       [](std::vector<int> elements) {
+         RC_PRE(!std::is_sorted(begin(elements), end(elements)));
+         auto sorted = elements;
+         std::sort(begin(sorted), end(sorted));
+         RC_ASSERT(*shrink::towardsSorted(elements).next() == sorted);
+       });
+
+  prop("every shrink has fewer inversions",
+       [](const std::vector<int> &elements) {
+         const auto n = inversions(elements);
+         seq::forEach(shrink::towardsSorted(elements),
+                      [=](const std::vector<int> &shrink) {
+                        RC_ASSERT(inversions(shrink) < n);
+                      });
+       });
+
+  prop("every shrink is a permutation of the original",
+       [](const std::vector<int> &elements) {
+         auto sorted = elements;
+         std::sort(begin(sorted), end(sorted));
+         seq::forEach(shrink::towardsSorted(elements),
+                      [=](std::vector<int> shrink) {
+                        std::sort(begin(shrink), end(shrink));
+                        RC_ASSERT(shrink == sorted);
+                      });
+       });
+
+  prop("sorted containers have no shrinks",
+       [](std::vector<int> elements) {
+         std::sort(begin(elements), end(elements));
+         RC_ASSERT(!shrink::towardsSorted(elements).next());
+       });
+
+  SECTION("ends with swaps of elements that are out of order") {
+    REQUIRE(shrink::towardsSorted(std::vector<int>{3, 1, 2}) ==
+            seq::just(std::vector<int>{1, 2, 3},
+                      std::vector<int>{1, 3, 2},
+                      std::vector<int>{2, 1, 3}));
+  }
+}
+
 TEST_CASE("shrink::towards") {
   forEachType<ShrinkTowardsProperties, RC_INTEGRAL_TYPES>();
 }
@@ -240,6 +302,30 @@ struct RealProperties {
     templatedProp<T>(
         "never contains original value",
         [](T x) { RC_ASSERT(!seq::contains(shrink::real<T>(x), x)); });
+
+    TEMPLATED_SECTION(T, "tries values with fewer decimals") {
+      const auto shrinks = shrink::real<T>(T(314159) / T(100000));
+      REQUIRE(seq::contains(shrinks, T(31) / T(10)));
+      REQUIRE(seq::contains(shrinks, T(314) / T(100)));
+    }
+
+    templatedProp<T>("integers shrink towards zero",
+                     [] {
+                       const auto value = static_cast<T>(
+                           *gen::suchThat<int>([](int x) { return x > 1; }));
+                       RC_ASSERT(seq::contains(shrink::real<T>(value),
+                                               value - std::trunc(value / 2)));
+                     });
+
+    TEMPLATED_SECTION(T, "NaN shrinks to zero") {
+      REQUIRE(shrink::real<T>(std::numeric_limits<T>::quiet_NaN()) ==
+              seq::just(T(0.0)));
+    }
+
+    TEMPLATED_SECTION(T, "negative infinity shrinks to zero and infinity") {
+      const auto inf = std::numeric_limits<T>::infinity();
+      REQUIRE(shrink::real<T>(-inf) == seq::just(T(0.0), inf));
+    }
   }
 };
 
@@ -5,6 +5,7 @@
 
 #include "util/Logger.h"
 #include "util/Generators.h"
+#include "util/ShrinkableUtils.h"
 
 using namespace rc;
 using namespace rc::test;
@@ -116,3 +117,36 @@ TEST_CASE("shrinkable::shrinkRecur") {
     REQUIRE(shrinkable.value().numberOf("copy") <= 1);
   }
 }
+
+TEST_CASE("shrinkable::shrinkContainer") {
+  prop("is equivalent to shrinkRecur with removeChunks and eachElement",
+       [] {
+         const auto elements =
+             *gen::resize(20, gen::arbitrary<std::vector<int>>());
+         const auto shrinkElement = [](int x) {
+           return shrink::towards(x, 0);
+         };
+         const auto expected = shrinkable::shrinkRecur(
+             elements,
+             [=](const std::vector<int> &x) {
+               return seq::concat(shrink::removeChunks(x),
+                                  shrink::eachElement(x, shrinkElement));
+             });
+
+         assertEquivalent(shrinkable::shrinkContainer(elements, shrinkElement),
+                          expected);
+       });
+
+  prop("works with strings",
+       [](const std::string &str) {
+         const auto shrinkable =
+             shrinkable::shrinkContainer(str, &shrink::character<char>);
+         RC_ASSERT(shrinkable.value() == str);
+         onAnyPath(shrinkable,
+                   [](const Shrinkable<std::string> &value,
+                      const Shrinkable<std::string> &shrink) {
+                     RC_ASSERT(shrink.value() != value.value());
+                     RC_ASSERT(shrink.value().find('\0') == std::string::npos);
+                   });
+       });
+}
@@ -12,15 +12,46 @@
 
 namespace rc {
 
+template <>
+struct Arbitrary<detail::SizeSchedule> {
+  static Gen<detail::SizeSchedule> arbitrary() {
+    return gen::element(detail::SizeSchedule::Linear,
+                        detail::SizeSchedule::Exponential,
+                        detail::SizeSchedule::Adaptive);
+  }
+};
+
+template <>
+struct Arbitrary<detail::ShrinkEngine> {
+  static Gen<detail::ShrinkEngine> arbitrary() {
+    return gen::element(detail::ShrinkEngine::Tree,
+                        detail::ShrinkEngine::Choices);
+  }
+};
+
+template <>
+struct Arbitrary<detail::CaseIsolation> {
+  static Gen<detail::CaseIsolation> arbitrary() {
+    return gen::element(detail::CaseIsolation::None,
+                        detail::CaseIsolation::Fork);
+  }
+};
+
 template <>
 struct Arbitrary<detail::TestParams> {
   static Gen<detail::TestParams> arbitrary() {
+    // failFast is left disabled since failures would cancel unrelated tests
+    // and case timeouts, isolation and memory limits are left disabled since
+    // those would abort, fork or starve the test runner
     return gen::build<detail::TestParams>(
         gen::set(&detail::TestParams::seed),
         gen::set(&detail::TestParams::maxSuccess, gen::inRange(0, 100)),
         gen::set(&detail::TestParams::maxSize, gen::inRange(0, 101)),
         gen::set(&detail::TestParams::maxDiscardRatio, gen::inRange(0, 100)),
-        gen::set(&detail::TestParams::disableShrinking));
+        gen::set(&detail::TestParams::disableShrinking),
+        gen::set(&detail::TestParams::shrinkEngine),
+        gen::set(&detail::TestParams::sizeSchedule),
+        gen::set(&detail::TestParams::coverageGuided));
   }
 };
 
@@ -61,7 +92,37 @@ struct Arbitrary<detail::Reproduce> {
         gen::set(&detail::Reproduce::size, gen::inRange<int>(0, 200)),
         gen::set(&detail::Reproduce::shrinkPath,
                  gen::container<std::vector<std::size_t>>(
-                     gen::inRange<std::size_t>(0, 200))));
+                     gen::inRange<std::size_t>(0, 200))),
+        gen::set(&detail::Reproduce::choices));
+  }
+};
+
+template <>
+struct Arbitrary<Complexity> {
+  static Gen<Complexity> arbitrary() {
+    return gen::element(Complexity::Constant,
+                        Complexity::Linear,
+                        Complexity::Linearithmic,
+                        Complexity::Quadratic);
+  }
+};
+
+template <>
+struct Arbitrary<detail::ComplexitySample> {
+  static Gen<detail::ComplexitySample> arbitrary() {
+    return gen::build<detail::ComplexitySample>(
+        gen::set(&detail::ComplexitySample::n),
+        gen::set(&detail::ComplexitySample::seconds),
+        gen::set(&detail::ComplexitySample::bound));
+  }
+};
+
+template <>
+struct Arbitrary<detail::TargetResult> {
+  static Gen<detail::TargetResult> arbitrary() {
+    return gen::build<detail::TargetResult>(
+        gen::set(&detail::TargetResult::value),
+        gen::set(&detail::TargetResult::example));
   }
 };
 
@@ -73,7 +134,9 @@ struct Arbitrary<detail::SuccessResult> {
         gen::set(&detail::SuccessResult::distribution,
                  gen::container<detail::Distribution>(
                      gen::scale(0.1, gen::arbitrary<detail::Tags>()),
-                     gen::arbitrary<int>())));
+                     gen::arbitrary<int>())),
+        gen::set(&detail::SuccessResult::target),
+        gen::set(&detail::SuccessResult::complexity));
   }
 };
 
@@ -110,6 +173,8 @@ struct Arbitrary<detail::CaseDescription> {
     return gen::build<detail::CaseDescription>(
         gen::set(&detail::CaseDescription::result),
         gen::set(&detail::CaseDescription::tags),
+        gen::set(&detail::CaseDescription::target),
+        gen::set(&detail::CaseDescription::complexity),
         gen::set(&detail::CaseDescription::example,
                  gen::map<detail::Example>(
                      [](detail::Example &&example)